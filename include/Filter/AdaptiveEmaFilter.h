@@ -0,0 +1,143 @@
+#pragma once
+
+#include <stdint.h>
+#include "interfaces/IFilter.h"
+#include "config/Config.h"
+#include "Filter/filter_utils.h"
+#include "logger/Logger.h"
+
+
+/**
+ * @brief Fixed-point EMA whose alpha follows the innovation magnitude
+ * 
+ * @details
+ *  - Same Q8-alpha fixed-point EMA as Q8EmaFilter, but alpha is picked per sample:
+ *      e     = x - y                                    (innovation)
+ *      noise = mean |e| (slow EMA, clipped so transients do not inflate it, floored at 0.5 LSB)
+ *      alpha = ALPHA_MIN, doubled for every doubling of |e| above NOISE_GATE * noise, capped at ALPHA_MAX
+ *  - Steady fridge: |e| stays in the noise band -> ALPHA_MIN, heavy smoothing.
+ *  - Door-open/defrost step: |e| jumps to many times the noise -> alpha goes straight to ALPHA_MAX and the
+ *    output catches up in a couple of readings, then alpha decays back as the innovation shrinks.
+ *  - Selection is compares and shifts only (no division): at most log2(MAX/MIN) loop iterations.
+ *  - Seeds from the first input; settled once the noise tracker has seen 2^NOISE_SHIFT readings.
+ * 
+ * @example
+ *  static AdaptiveEmaFilter<int16_t> filter;                  // Filtering::ADAPTIVE_* defaults
+ *  static AdaptiveEmaFilter<int16_t> smooth(8, 128);          // alpha between 8/256 and 128/256
+ * 
+ * @tparam T          Sample type (integral, up to 16 bits)
+ * @tparam FracBits   Extra fractional bits in the state
+ */
+template<typename T, uint8_t FracBits = Filtering::EMA_FRAC_BITS>
+class AdaptiveEmaFilter : public IFilter<T>
+{
+    static_assert(sizeof(T) <= 2, "AdaptiveEmaFilter: state is int32_t, samples must fit in 16 bits");
+    static_assert(FracBits == 8, "AdaptiveEmaFilter: noise floor/tracker are expressed in Q8");
+
+    public:
+
+        /**
+         * @brief Construct a new Adaptive Ema Filter object
+         * 
+         * @param alpha_min_q8 - Steady state alpha scaled by 256
+         * @param alpha_max_q8 - Transient alpha scaled by 256
+         */
+        AdaptiveEmaFilter(uint8_t alpha_min_q8 = Filtering::ADAPTIVE_ALPHA_MIN_Q8, uint8_t alpha_max_q8 = Filtering::ADAPTIVE_ALPHA_MAX_Q8):
+        alphaMin_(alpha_min_q8),
+        alphaMax_(alpha_max_q8),
+        alpha_(alpha_min_q8),
+        state_(0),
+        noise_(Filtering::ADAPTIVE_NOISE_FLOOR_Q8),
+        count_(0),
+        initialize_(false)
+        {};
+
+        /// @brief Final initialization: alpha range validation
+        void begin()
+        {
+            if(initialize_) return;
+
+            if(alphaMin_ == 0 || alphaMax_ < alphaMin_)
+            {
+                LOGW("AdaptiveEmaFilter:: Invalid alpha range %d..%d - using defaults", alphaMin_, alphaMax_);
+                alphaMin_ = Filtering::ADAPTIVE_ALPHA_MIN_Q8;
+                alphaMax_ = Filtering::ADAPTIVE_ALPHA_MAX_Q8;
+            }
+
+            initialize_ = true;
+        };
+
+        // --- Implemented method from IFilter ---
+
+        /**
+         * @brief Applies the EMA with an alpha chosen from the innovation/noise ratio
+         * 
+         * @param new_value New input value.
+         * @return T Filtered value (rounded).
+         */
+        T apply(T new_value) override
+        {
+            constexpr int32_t ONE = static_cast<int32_t>(1) << FracBits;
+            const int32_t target = static_cast<int32_t>(new_value) * ONE;
+
+            // Step0: Seed from the first real input
+            if(count_ == 0)
+            {
+                count_ = 1;
+                state_ = target;
+                noise_ = Filtering::ADAPTIVE_NOISE_FLOOR_Q8;
+                alpha_ = alphaMin_;
+                return new_value;
+            }
+            if(count_ < (1u << Filtering::ADAPTIVE_NOISE_SHIFT)) ++count_;
+
+            // Step1: Innovation magnitude (Q8)
+            const int32_t innovation = target - state_;
+            const uint32_t magnitude = static_cast<uint32_t>(innovation < 0 ? -innovation : innovation);
+
+            // Step2: Alpha: double per doubling of |e| above the noise gate
+            uint16_t alpha = alphaMin_;
+            uint32_t gate  = static_cast<uint32_t>(noise_) * Filtering::ADAPTIVE_NOISE_GATE;
+            while(magnitude > gate && alpha < alphaMax_)
+            {
+                alpha <<= 1;
+                gate  <<= 1;
+            }
+            alpha_ = static_cast<uint8_t>((alpha > alphaMax_) ? alphaMax_ : alpha);
+
+            // Step3: Smooth the state
+            state_ += filter_utils::mulQ8(innovation, alpha_);
+
+            // Step4: Track the noise with |e| clipped to twice the gate (a transient must not look like noise)
+            const uint32_t clipGate = static_cast<uint32_t>(noise_) * Filtering::ADAPTIVE_NOISE_GATE * 2;
+            const int32_t  sample   = static_cast<int32_t>((magnitude > clipGate) ? clipGate : magnitude);
+            noise_ += filter_utils::roundedShift(sample - noise_, Filtering::ADAPTIVE_NOISE_SHIFT);
+            if(noise_ < Filtering::ADAPTIVE_NOISE_FLOOR_Q8) noise_ = Filtering::ADAPTIVE_NOISE_FLOOR_Q8;
+
+            return static_cast<T>(filter_utils::roundedShift(state_, FracBits));
+        }
+
+        /// @brief Forget the state: the next apply() seeds the filter again
+        void reset() override { count_ = 0; }
+
+        /// @brief True once the noise tracker has seen 2^NOISE_SHIFT readings
+        bool isSettled() const override { return count_ >= (1u << Filtering::ADAPTIVE_NOISE_SHIFT); }
+
+        // ----------------------------------------
+
+        /// @brief Alpha used for the last reading (Q8), e.g. for telemetry
+        uint8_t alpha_q8() const noexcept { return alpha_; }
+
+        /// @brief Tracked noise: mean |innovation| in LSB scaled by 256
+        int32_t noise_q8() const noexcept { return noise_; }
+
+    private:
+        uint8_t alphaMin_;  // Steady state alpha (Q8)
+        uint8_t alphaMax_;  // Transient alpha (Q8)
+        uint8_t alpha_;     // Alpha used for the last reading (Q8)
+        int32_t state_;     // State: filtered value scaled by 2^FracBits
+        int32_t noise_;     // Mean |innovation| (Q8)
+        uint8_t count_;     // Samples seen since seeding (saturates at 2^NOISE_SHIFT)
+
+        bool initialize_;   // To avoid reinitialization
+};
@@ -0,0 +1,110 @@
+#pragma once
+
+#include <stdint.h>
+#include "Filter/filter_utils.h"
+
+
+/**
+ * @brief Integer CIC (cascaded integrator-comb) decimator
+ * 
+ * @details
+ *  - Order integrators run at the input rate, Order combs (differential delay 1) run once every Ratio inputs.
+ *  - Only additions/subtractions on uint32_t: the registers wrap modulo 2^32 and the wrap cancels out in the
+ *    combs, which is the standard CIC argument (no overflow checks needed, only enough register width).
+ *  - Frequency response: sinc^Order low-pass with nulls at every multiple of the output rate, so it averages
+ *    and anti-aliases in one step instead of throwing away everything between block averages.
+ *  - Gain is Ratio^Order: push() keeps the full-precision output (cheap, ISR side), normalized() scales it back
+ *    to input counts outside the ISR (a shift when Ratio is a power of two).
+ *  - Cost per input: Order 32-bit adds + a counter, plus Order 32-bit subtractions every Ratio inputs.
+ * 
+ * @example
+ *  CicDecimator<3, 64> cic;
+ *  if(cic.push(ADC)) latest = cic.output();     // inside ADC_vect
+ *  uint16_t counts = CicDecimator<3, 64>::normalized(latest);
+ * 
+ * @tparam Order - Number of integrator/comb stages (1..5)
+ * @tparam Ratio - Decimation ratio (> 1)
+ * @tparam InputBits - Width of the input samples (10-bit ADC by default)
+ */
+template<uint8_t Order, uint16_t Ratio, uint8_t InputBits = 10>
+class CicDecimator
+{
+    static_assert(Order >= 1 && Order <= 5, "CicDecimator: Order must be 1..5");
+    static_assert(Ratio > 1, "CicDecimator: Ratio must be > 1");
+
+    /// @brief Ratio^Order computed at compile time
+    static constexpr uint32_t power(uint32_t base, uint8_t exp) { return exp ? base * power(base, exp - 1) : 1; }
+
+    public:
+
+        static constexpr uint32_t GAIN = power(Ratio, Order);                   // DC gain of the decimator
+
+        static_assert(InputBits + Order * filter_utils::log2Floor(Ratio) + (filter_utils::isPowerOfTwo(Ratio) ? 0 : Order) <= 32,
+                      "CicDecimator: InputBits + Order * log2(Ratio) must fit in 32 bits");
+
+        /// @brief Construct a cleared decimator
+        CicDecimator():
+        integrators_{},
+        combs_{},
+        output_(0),
+        phase_(0),
+        primed_(0)
+        {};
+
+        /**
+         * @brief Feed one input sample (ISR safe: adds only)
+         * 
+         * @param sample - Input sample
+         * @return true  - A decimated output is ready (read it with output())
+         * @return false - Still accumulating
+         */
+        inline bool push(uint16_t sample)
+        {
+            // Integrators (input rate)
+            integrators_[0] += sample;
+            for(uint8_t k = 1; k < Order; ++k) integrators_[k] += integrators_[k - 1];
+
+            if(++phase_ < Ratio) return false;
+            phase_ = 0;
+
+            // Combs (output rate)
+            uint32_t value = integrators_[Order - 1];
+            for(uint8_t k = 0; k < Order; ++k)
+            {
+                const uint32_t delayed = combs_[k];
+                combs_[k] = value;
+                value -= delayed;
+            }
+            output_ = value;
+
+            // The first Order outputs still carry the start-up transient of the combs
+            if(primed_ < Order + 1) ++primed_;
+            return primed_ > Order;
+        }
+
+        /// @brief Last full-precision output (input counts * GAIN)
+        inline uint32_t output() const { return output_; }
+
+        /// @brief True once the start-up transient has gone through the combs
+        inline bool isPrimed() const { return primed_ > Order; }
+
+        /// @brief Scale a full-precision output back to input counts (rounded)
+        static inline uint32_t normalized(uint32_t output) { return filter_utils::roundedDivide<GAIN>(output); }
+
+        /// @brief Clear all the registers
+        void reset()
+        {
+            for(uint8_t k = 0; k < Order; ++k) { integrators_[k] = 0; combs_[k] = 0; }
+            output_ = 0;
+            phase_  = 0;
+            primed_ = 0;
+        }
+
+    private:
+
+        uint32_t integrators_[Order];   // Integrator registers (wrap modulo 2^32)
+        uint32_t combs_[Order];         // Comb delay registers
+        uint32_t output_;               // Last decimated output (full precision)
+        uint16_t phase_;                // Inputs since last output
+        uint8_t primed_;                // Outputs since reset (saturates at Order + 1)
+};
@@ -1,49 +1,63 @@
 #pragma once
 
+#include <stdint.h>
 #include "interfaces/IFilter.h"
+#include "config/Config.h"
 #include "logger/Logger.h"
 
 
 /**
  * @brief Applies Exponential Moving Average (EMA) to a new value.
- * 
- * @details EMA is a first-order infinite impulse response (IIR) low-pass filter 
+ *
+ * @details EMA is a first-order infinite impulse response (IIR) low-pass filter
  *  - A difference of the SMA this version of the EMA filter is not windowed, so it depends of all previous values
  *  - Because the calculation of the result does not requires storage this make it memory and computationally friendly(suitable fro embedded environments)
  *  - the constant alpha(0 < alpha < 1) determine how aggressive the filter is:
  *      alpha -> 0: Gives less weight to the to the new_value,
- *      alpha -> 1: Gives more weight to the previous value. 
+ *      alpha -> 1: Gives more weight to the previous value.
  *  - Formula:
  *      y = (1-alpha)) * prev_input + alpha * input ; with (0 <alpha <1)
- * 
- * @tparam T 
+ *  - Seeding: the first apply() after construction/reset() returns its input and becomes the state,
+ *    so the output is valid from the first sample (no ramp from 0 after every reboot).
+ *  - Warm-up (optional): sample n uses weight max(1/n, alpha), i.e. a plain running average until
+ *    n reaches 1/alpha, then the regular EMA. isSettled() reports when the warm-up is over.
+ *
+ * @tparam T
  */
 template<typename T>
 class EmaFilter : public IFilter<T>
 {
     public:
-        
+
         /**
          * @brief Construct a new Ema Filter object
-         * 
+         *
          * @param alpha - Smoothing factor (0 < alpha < 1) inclusive
-         * @param initial_value - init value to apply to the filtered output
+         * @param warm_up - WarmUp::On -> 1/n weighting until n reaches 1/alpha
          */
-        EmaFilter(float alpha, T initial_value = 0):
+        explicit EmaFilter(float alpha, WarmUp warm_up = static_cast<WarmUp>(Filtering::WARMUP_DEFAULT)):
         alpha_(alpha),
-        prev_value_(initial_value),
+        prev_value_(0),
+        count_(0),
+        warmupLength_((warm_up == WarmUp::On) ? warmupLength(alpha) : 1),
         initialize_(false)
         {};
 
         /// @brief Final initialization: Alpha validation
         void begin()
         {
-            // Validate alpha  
-            if (alpha_ < 0 || alpha_ >1)
+            // Skip if already initialize
+            if(initialize_) return;
+
+            // Validate alpha
+            if (alpha_ <= 0 || alpha_ >1)
             {
                 LOGW("Invalid EMA alpha: %f.2 - clamping to 0.5",alpha_);   // LOG warning
-                alpha_ = 0.5;                                               // Set to a safe default value    
-            }            
+                alpha_ = 0.5;                                               // Set to a safe default value
+                if(warmupLength_ > 1) warmupLength_ = warmupLength(alpha_);
+            }
+
+            initialize_ = true;
         };
 
 
@@ -51,21 +65,55 @@ class EmaFilter : public IFilter<T>
 
         /**
          * @brief Applies Exponential Moving Average (EMA) to a new value.
-         * 
+         *
          * @param new_value New input value.
          * @return T Filtered value.
          */
         T apply(T new_value) override
         {
-            prev_value_ = static_cast<T>((1 - alpha_)* prev_value_ + alpha_*new_value);  // Update prev value
+            // Seed from the first real input
+            if(count_ == 0)
+            {
+                count_ = 1;
+                prev_value_ = new_value;
+                return prev_value_;
+            }
+
+            // Warm-up: running average (weight 1/n) until 1/n drops to alpha (the last step may be below: clamp)
+            float weight = alpha_;
+            if(count_ < warmupLength_)
+            {
+                ++count_;
+                const float average = 1.0f / static_cast<float>(count_);
+                if(average > alpha_) weight = average;
+            }
+
+            prev_value_ = static_cast<T>((1 - weight)* prev_value_ + weight*new_value);   // Update prev value
             return prev_value_;                                                          // return current State
         }
 
+        /// @brief Forget the state: the next apply() seeds the filter again
+        void reset() override { count_ = 0; }
+
+        /// @brief True once seeded and the warm-up is over
+        bool isSettled() const override { return count_ != 0 && count_ >= warmupLength_; }
+
         // ----------------------------------------
-        
+
     private:
-        float alpha_;       // Smoothing factor
-        T prev_value_;      // State: Store previous filtered value
 
-        bool  initialize_;  // To avoid reinitialization
-};
\ No newline at end of file
+        /// @brief Number of samples weighted 1/n before switching to alpha: ceil(1/alpha), saturated to 255
+        static uint8_t warmupLength(float alpha)
+        {
+            if(alpha <= 0.0f || alpha >= 1.0f) return 1;
+            const float n = 1.0f / alpha;
+            return (n >= 255.0f) ? 255 : static_cast<uint8_t>(n + 0.999f);
+        }
+
+        float alpha_;           // Smoothing factor
+        T prev_value_;          // State: Store previous filtered value
+        uint8_t count_;         // Samples seen since seeding (saturates at warmupLength_)
+        uint8_t warmupLength_;  // Samples of 1/n weighting (1 -> no warm-up)
+
+        bool  initialize_;      // To avoid reinitialization
+};
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include "config/Config.h"
+#include "Filter/filter_utils.h"
+
+
+/**
+ * @brief Multi-channel fixed-point EMA bank with Structure-of-Arrays state
+ * 
+ * @details
+ *  - Holds the filter state of N channels in one contiguous int32_t array instead of N filter objects
+ *    scattered in globals and reached through IFilter pointers.
+ *  - update() steps every channel in one call after a scan: same shift/round math as ShiftEmaFilter,
+ *    one straight loop with no virtual call and no per-channel branch, so the cost per channel is fixed
+ *    (8-16 probes on one board) and host builds auto-vectorise it (-O3) for offline trace processing.
+ *  - Invalid readings (Sensors::INVALID_READING_X10 sentinel) leave that channel untouched (branch-free select).
+ *  - Seeding: per channel, from its first valid input after construction/reset(). Until then the
+ *    channel outputs Sensors::INVALID_READING_X10 (a probe faulted at boot never seeds the state with it).
+ * 
+ * @example
+ *  static FilterBank<4> bank;                      // alpha = 2^-Filtering::EMA_ALPHA_SHIFT_DEFAULT
+ *  int16_t raw[4], filtered[4];
+ *  // ... scan the probes into raw[] ...
+ *  bank.update(raw, filtered);
+ * 
+ * @tparam N          Number of channels
+ * @tparam AlphaShift alpha = 2^-AlphaShift
+ * @tparam FracBits   Extra fractional bits in the state
+ */
+template<size_t N, uint8_t AlphaShift = Filtering::EMA_ALPHA_SHIFT_DEFAULT, uint8_t FracBits = Filtering::EMA_FRAC_BITS>
+class FilterBank
+{
+    static_assert(N > 0, "FilterBank: needs at least one channel");
+    static_assert(AlphaShift > 0 && FracBits >= AlphaShift && FracBits <= 15, "FilterBank: need 0 < AlphaShift <= FracBits <= 15");
+
+    public:
+
+        /// @brief Construct an unseeded bank
+        FilterBank():
+        state_{},
+        seeded_{}
+        {};
+
+        /// @brief Final initialization (nothing to validate, kept for initSubSystems())
+        void begin() {};
+
+        /**
+         * @brief Step every channel with a new scan
+         * 
+         * @param in  - N new readings (x10 °C), Sensors::INVALID_READING_X10 to skip a channel
+         * @param out - N filtered readings (may alias in)
+         */
+        void update(const int16_t* in, int16_t* out)
+        {
+            constexpr int32_t ONE = static_cast<int32_t>(1) << FracBits;
+
+            // One straight loop: no call, no per-channel branch (the selects become blends)
+            for(size_t i = 0; i < N; ++i)
+            {
+                const bool    valid  = (in[i] != Sensors::INVALID_READING_X10);
+                const int32_t target = static_cast<int32_t>(in[i]) * ONE;
+                const int32_t step   = filter_utils::roundedShift(target - state_[i], AlphaShift);
+
+                // Seed each channel from its first valid input, then step; invalid inputs leave it untouched
+                state_[i]  = (valid && !seeded_[i]) ? target : state_[i] + (valid ? step : 0);
+                seeded_[i] = static_cast<uint8_t>(seeded_[i] | valid);
+                out[i] = seeded_[i] ? static_cast<int16_t>(filter_utils::roundedShift(state_[i], FracBits)) : Sensors::INVALID_READING_X10;
+            }
+        }
+
+        /// @brief Array overload: the channel count is checked at compile time
+        void update(const int16_t (&in)[N], int16_t (&out)[N]) { update(&in[0], &out[0]); }
+
+        /// @brief Filtered value of one channel (rounded), Sensors::INVALID_READING_X10 until it is seeded
+        int16_t value(size_t channel) const noexcept
+        {
+            return (channel < N && seeded_[channel]) ? static_cast<int16_t>(filter_utils::roundedShift(state_[channel], FracBits)) : Sensors::INVALID_READING_X10;
+        }
+
+        /// @brief Forget every channel: each one seeds again from its next valid input
+        void reset() { for(size_t i = 0; i < N; ++i) seeded_[i] = 0; }
+
+        /// @brief Number of channels
+        static constexpr size_t size() { return N; }
+
+    private:
+
+        int32_t state_[N];      // State: filtered value of each channel scaled by 2^FracBits
+        uint8_t seeded_[N];     // Channel seeded from a valid input (byte flags: keeps the loop vectorisable)
+};
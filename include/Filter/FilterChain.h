@@ -0,0 +1,137 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include "interfaces/IFilter.h"
+#include "Filter/filter_utils.h"
+
+
+namespace filter_chain_detail
+{
+    /**
+     * @brief Recursive storage for the chain stages (tuple-like, no STL)
+     * 
+     * @details Each level holds one stage by value and calls it on its exact type, so the call is
+     *          resolved at compile time (no vtable lookup) and can be inlined into the next stage.
+     */
+    template<typename T, typename... Stages>
+    struct Chain;
+
+    /// @brief End of the chain: identity
+    template<typename T>
+    struct Chain<T>
+    {
+        inline T apply(T value) { return value; }
+        inline T applyAt(T value, uint32_t) { return value; }
+        inline void begin() {}
+        inline void reset() {}
+        inline bool isSettled() const { return true; }
+    };
+
+    template<typename T, typename Head, typename... Tail>
+    struct Chain<T, Head, Tail...>
+    {
+        Chain() = default;
+        Chain(const Head& h, const Tail&... t): head(h), tail(t...) {}
+
+        inline T apply(T value) { return tail.apply(static_cast<T>(head.apply(value))); }
+        inline T applyAt(T value, uint32_t timestamp_ms) { return tail.applyAt(filter_utils::applyAt(head, value, timestamp_ms), timestamp_ms); }
+        inline void begin() { head.begin(); tail.begin(); }
+        inline void reset() { head.reset(); tail.reset(); }
+        inline bool isSettled() const { return head.isSettled() && tail.isSettled(); }
+
+        Head head;                  // This stage
+        Chain<T, Tail...> tail;     // Remaining stages
+    };
+
+    /// @brief Compile-time access to stage I
+    template<size_t I, typename T, typename Head, typename... Tail>
+    struct StageAt
+    {
+        using type = typename StageAt<I - 1, T, Tail...>::type;
+        static type& get(Chain<T, Head, Tail...>& c) { return StageAt<I - 1, T, Tail...>::get(c.tail); }
+    };
+
+    template<typename T, typename Head, typename... Tail>
+    struct StageAt<0, T, Head, Tail...>
+    {
+        using type = Head;
+        static type& get(Chain<T, Head, Tail...>& c) { return c.head; }
+    };
+
+} // namespace filter_chain_detail
+
+
+/**
+ * @brief Compile-time filter pipeline exposed as a single IFilter<T>
+ * 
+ * @details
+ *  - Composes any number of stages that provide apply(T) / begin() / reset() / isSettled().
+ *    Stages run in declaration order: the output of one is the input of the next.
+ *  - Only the chain itself is reached through IFilter (one virtual call per reading); inside the chain
+ *    every stage is called on its exact type, so the compiler can inline the whole pipeline.
+ *  - Plain stages (e.g. MedianOf3) add no vtable at all. Stages that also implement IFilter
+ *    (EmaFilter, ShiftEmaFilter, SmaFilter...) work as well and are devirtualized the same way.
+ *  - Settled only when every stage is settled; reset() resets all of them.
+ *  - applyAt() hands the sample timestamp to the stages that declare their own applyAt() (time-aware models
+ *    such as LagCompensationFilter); the other stages get a plain apply().
+ * 
+ * @example
+ *  // Outlier rejection in front of smoothing, one IFilter for the TemperatureSensor
+ *  static FilterChain<int16_t, MedianOf3<int16_t>, ShiftEmaFilter<int16_t>> fridgeFilter;
+ *  // Stages that need constructor arguments
+ *  static FilterChain<int16_t, MedianOf3<int16_t>, EmaFilter<int16_t>> evaporatorFilter(
+ *      MedianOf3<int16_t>(), EmaFilter<int16_t>(Filtering::EMA_ALPHA_DEFAULT));
+ *  sensor.addFilter(&fridgeFilter);
+ * 
+ * @tparam T       Sample type
+ * @tparam Stages  Stage types, applied in order
+ */
+template<typename T, typename... Stages>
+class FilterChain : public IFilter<T>
+{
+    static_assert(sizeof...(Stages) > 0, "FilterChain: needs at least one stage");
+
+    public:
+
+        /// @brief Default-construct every stage
+        FilterChain() = default;
+
+        /// @brief Copy-construct every stage from a configured instance
+        explicit FilterChain(const Stages&... stages): chain_(stages...) {}
+
+        /// @brief Final initialization: forwards begin() to every stage
+        void begin() { chain_.begin(); }
+
+        /// @brief Access stage I (e.g. to read its state or tune it at runtime)
+        template<size_t I>
+        typename filter_chain_detail::StageAt<I, T, Stages...>::type& stage()
+        {
+            return filter_chain_detail::StageAt<I, T, Stages...>::get(chain_);
+        }
+
+        // --- Implemented method from IFilter ---
+
+        /**
+         * @brief Run the new value through every stage
+         * 
+         * @param new_value New input value.
+         * @return T Output of the last stage.
+         */
+        T apply(T new_value) override { return chain_.apply(new_value); }
+
+        /// @brief Run the new value through every stage, time-aware stages get its timestamp
+        T applyAt(T new_value, uint32_t timestamp_ms) override { return chain_.applyAt(new_value, timestamp_ms); }
+
+        /// @brief Reset every stage
+        void reset() override { chain_.reset(); }
+
+        /// @brief True when every stage is settled
+        bool isSettled() const override { return chain_.isSettled(); }
+
+        // ----------------------------------------
+
+    private:
+
+        filter_chain_detail::Chain<T, Stages...> chain_;    // Stages by value
+};
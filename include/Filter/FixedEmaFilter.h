@@ -0,0 +1,219 @@
+#pragma once
+
+#include <stdint.h>
+#include "interfaces/IFilter.h"
+#include "config/Config.h"
+#include "Filter/filter_utils.h"
+#include "logger/Logger.h"
+
+
+/**
+ * @brief Fixed-point Exponential Moving Average (EMA) with alpha = 2^-AlphaShift
+ * 
+ * @details
+ *  Same first-order IIR low-pass as EmaFilter, without software float:
+ *  - The state keeps FracBits extra fractional bits: s = y * 2^FracBits (int32_t).
+ *  - Update is a subtraction and a rounded arithmetic shift:
+ *      s += round(((x << FracBits) - s) / 2^AlphaShift)
+ *  - Output is the state rounded back to T: y = round(s / 2^FracBits).
+ *  - With FracBits >= AlphaShift the state settles within half an LSB of a constant input, so there is
+ *    no steady-state bias and the output cannot stick one LSB away (EmaFilter truncates toward zero).
+ *  - Seeds from the first input. Optional warm-up: the shift starts at 1 and grows by one every time the
+ *    sample count reaches the next power of two (weight ~1/n) until it reaches AlphaShift.
+ * 
+ * @note On the ATmega328P a float EMA costs two __mulsf3, one __addsf3 and the int<->float conversions
+ *       (several hundred cycles). This one is a handful of 32-bit add/shift instructions.
+ * 
+ * @example
+ *  static ShiftEmaFilter<int16_t> filter;                  // alpha = 2^-Filtering::EMA_ALPHA_SHIFT_DEFAULT
+ *  static ShiftEmaFilter<int16_t, 2> fastFilter(WarmUp::Off); // alpha = 0.25, no warm-up
+ * 
+ * @tparam T          Sample type (integral, up to 16 bits)
+ * @tparam AlphaShift alpha = 2^-AlphaShift (1..FracBits)
+ * @tparam FracBits   Extra fractional bits in the state
+ */
+template<typename T, uint8_t AlphaShift = Filtering::EMA_ALPHA_SHIFT_DEFAULT, uint8_t FracBits = Filtering::EMA_FRAC_BITS>
+class ShiftEmaFilter : public IFilter<T>
+{
+    static_assert(sizeof(T) <= 2, "ShiftEmaFilter: state is int32_t, samples must fit in 16 bits");
+    static_assert(AlphaShift > 0, "ShiftEmaFilter: AlphaShift must be > 0 (alpha = 1 means no filtering)");
+    static_assert(FracBits >= AlphaShift && FracBits <= 15, "ShiftEmaFilter: need AlphaShift <= FracBits <= 15");
+
+    public:
+
+        /**
+         * @brief Construct a new Shift Ema Filter object
+         * 
+         * @param warm_up - WarmUp::On -> ~1/n weighting (power of two steps) until n reaches 2^AlphaShift
+         */
+        explicit ShiftEmaFilter(WarmUp warm_up = static_cast<WarmUp>(Filtering::WARMUP_DEFAULT)):
+        state_(0),
+        count_(0),
+        shift_(0),
+        warmUp_(warm_up == WarmUp::On),
+        initialize_(false)
+        {};
+
+        /// @brief Final initialization
+        void begin()
+        {
+            if(initialize_) return;
+
+            LOGD("ShiftEmaFilter:: alpha = 1/%d, frac bits = %d", 1 << AlphaShift, FracBits);
+
+            initialize_ = true;
+        };
+
+        // --- Implemented method from IFilter ---
+
+        /**
+         * @brief Applies the fixed-point EMA to a new value.
+         * 
+         * @param new_value New input value.
+         * @return T Filtered value (rounded).
+         */
+        T apply(T new_value) override
+        {
+            const int32_t target = static_cast<int32_t>(new_value) * (static_cast<int32_t>(1) << FracBits);
+
+            // Seed from the first real input
+            if(count_ == 0)
+            {
+                count_ = 1;
+                shift_ = warmUp_ ? 0 : AlphaShift;
+                state_ = target;
+                return new_value;
+            }
+
+            // Warm-up: next power of two reached -> halve the weight
+            if(shift_ < AlphaShift && ++count_ == (static_cast<uint16_t>(1) << (shift_ + 1))) ++shift_;
+
+            state_ += filter_utils::roundedShift(target - state_, shift_);
+            return static_cast<T>(filter_utils::roundedShift(state_, FracBits));
+        }
+
+        /// @brief Forget the state: the next apply() seeds the filter again
+        void reset() override { count_ = 0; }
+
+        /// @brief True once seeded and the shift reached AlphaShift
+        bool isSettled() const override { return count_ != 0 && shift_ == AlphaShift; }
+
+        // ----------------------------------------
+
+    private:
+        int32_t state_;     // State: filtered value scaled by 2^FracBits
+        uint16_t count_;    // Samples seen since seeding (only counted during warm-up)
+        uint8_t shift_;     // Current weight = 2^-shift_ (grows up to AlphaShift)
+        bool warmUp_;       // Warm-up enabled
+
+        bool initialize_;   // To avoid reinitialization
+};
+
+
+/**
+ * @brief Fixed-point Exponential Moving Average (EMA) with a Q8 alpha multiplier
+ * 
+ * @details
+ *  Same as ShiftEmaFilter when alpha is not a power of two: alpha = alpha_q8 / 256.
+ *  - s += round(((x << FracBits) - s) * alpha_q8 / 256)
+ *  - The product is split in high/low bytes so it never overflows int32_t:
+ *      d * a / 256 = (d >> 8) * a + ((d & 0xFF) * a) / 256
+ *  - Costs one 16x8 and one 8x8 multiply on AVR (hardware MUL), still far below the float version.
+ *  - Seeds from the first input. Optional warm-up: weight max(256/n, alpha_q8) (one 16-bit division per
+ *    sample, only while warming up).
+ * 
+ * @example
+ *  static Q8EmaFilter<int16_t> filter(Filtering::EMA_ALPHA_Q8_DEFAULT);   // alpha ~= 0.148
+ * 
+ * @tparam T          Sample type (integral, up to 16 bits)
+ * @tparam FracBits   Extra fractional bits in the state
+ */
+template<typename T, uint8_t FracBits = Filtering::EMA_FRAC_BITS>
+class Q8EmaFilter : public IFilter<T>
+{
+    static_assert(sizeof(T) <= 2, "Q8EmaFilter: state is int32_t, samples must fit in 16 bits");
+    static_assert(FracBits >= 8 && FracBits <= 15, "Q8EmaFilter: need 8 <= FracBits <= 15 for a bias free Q8 alpha");
+
+    public:
+
+        /**
+         * @brief Construct a new Q8 Ema Filter object
+         * 
+         * @param alpha_q8 - Smoothing factor scaled by 256 (1..255)
+         * @param warm_up - WarmUp::On -> 1/n weighting until 256/n drops to alpha_q8
+         */
+        explicit Q8EmaFilter(uint8_t alpha_q8 = Filtering::EMA_ALPHA_Q8_DEFAULT, WarmUp warm_up = static_cast<WarmUp>(Filtering::WARMUP_DEFAULT)):
+        alpha_q8_(alpha_q8),
+        weight_q8_(alpha_q8),
+        state_(0),
+        count_(0),
+        warmUp_(warm_up == WarmUp::On),
+        initialize_(false)
+        {};
+
+        /// @brief Final initialization: Alpha validation
+        void begin()
+        {
+            if(initialize_) return;
+
+            if(alpha_q8_ == 0)
+            {
+                LOGW("Invalid Q8 EMA alpha: 0 - clamping to 128 (0.5)");
+                alpha_q8_ = 128;
+                weight_q8_ = 128;
+            }
+
+            initialize_ = true;
+        };
+
+        // --- Implemented method from IFilter ---
+
+        /**
+         * @brief Applies the fixed-point EMA to a new value.
+         * 
+         * @param new_value New input value.
+         * @return T Filtered value (rounded).
+         */
+        T apply(T new_value) override
+        {
+            const int32_t target = static_cast<int32_t>(new_value) * (static_cast<int32_t>(1) << FracBits);
+
+            // Seed from the first real input
+            if(count_ == 0)
+            {
+                count_ = 1;
+                weight_q8_ = alpha_q8_;
+                state_ = target;
+                return new_value;
+            }
+
+            // Warm-up: weight 256/n until it reaches alpha
+            if(warmUp_ && count_ < 255)
+            {
+                const uint16_t w = 256u / ++count_;
+                if(w > alpha_q8_) weight_q8_ = static_cast<uint8_t>(w);
+                else { weight_q8_ = alpha_q8_; count_ = 255; }
+            }
+
+            // (delta * alpha) / 256 without a 32x8 -> 40 bit product
+            state_ += filter_utils::mulQ8(target - state_, weight_q8_);
+            return static_cast<T>(filter_utils::roundedShift(state_, FracBits));
+        }
+
+        /// @brief Forget the state: the next apply() seeds the filter again
+        void reset() override { count_ = 0; }
+
+        /// @brief True once seeded and the weight reached alpha
+        bool isSettled() const override { return count_ != 0 && (!warmUp_ || count_ == 255); }
+
+        // ----------------------------------------
+
+    private:
+        uint8_t alpha_q8_;  // Smoothing factor scaled by 256
+        uint8_t weight_q8_; // Weight in use (256/n during warm-up, then alpha_q8_)
+        int32_t state_;     // State: filtered value scaled by 2^FracBits
+        uint8_t count_;     // Samples seen since seeding (255 -> warm-up over)
+        bool warmUp_;       // Warm-up enabled
+
+        bool initialize_;   // To avoid reinitialization
+};
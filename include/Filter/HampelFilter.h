@@ -0,0 +1,137 @@
+#pragma once
+
+#include <stdint.h>
+#include "interfaces/IFilter.h"
+#include "config/Config.h"
+#include "Filter/filter_utils.h"
+#include "logger/Logger.h"
+
+
+/**
+ * @brief Hampel outlier-rejection filter (median + MAD over a short window)
+ * 
+ * @details
+ *  - Keeps the last Window raw readings (ring buffer).
+ *  - m   = median(window)                 -> fixed sorting network on a copy
+ *  - MAD = median(|window - m|)           -> same network on the deviations
+ *  - If |x - m| > k * 1.4826 * MAD (at least Filtering::HAMPEL_MIN_DEVIATION) the reading is replaced by m,
+ *    otherwise it passes through untouched (no smoothing, no lag on clean data).
+ *  - The history keeps the raw readings, so a real step is accepted after (Window + 1) / 2 readings.
+ *  - Meant to run in front of the smoothing stage: a single glitch never reaches the EMA, so the EMA can
+ *    use a faster alpha. Use it alone or inside a FilterChain:
+ *      FilterChain<int16_t, HampelFilter<>, ShiftEmaFilter<int16_t, 2>> filter;
+ * 
+ * @tparam Window - Window length (3, 5 or 7)
+ */
+template<uint8_t Window = Filtering::HAMPEL_WINDOW>
+class HampelFilter : public IFilter<int16_t>
+{
+    public:
+
+        /**
+         * @brief Construct a new Hampel Filter object
+         * 
+         * @param threshold_q4 - k * 1.4826 in Q4 (e.g. 71 -> k = 3)
+         * @param min_deviation - Smallest deviation that can be rejected (x10 °C)
+         */
+        HampelFilter(uint8_t threshold_q4 = Filtering::HAMPEL_THRESHOLD_Q4, uint8_t min_deviation = Filtering::HAMPEL_MIN_DEVIATION):
+        history_{},
+        head_(0),
+        count_(0),
+        rejected_(0),
+        thresholdQ4_(threshold_q4),
+        minDeviation_(min_deviation),
+        initialize_(false)
+        {};
+
+        /// @brief Final initialization: threshold validation
+        void begin()
+        {
+            if(initialize_) return;
+
+            if(thresholdQ4_ == 0)
+            {
+                LOGW("HampelFilter:: Invalid threshold 0 - using %d", Filtering::HAMPEL_THRESHOLD_Q4);
+                thresholdQ4_ = Filtering::HAMPEL_THRESHOLD_Q4;
+            }
+
+            initialize_ = true;
+        };
+
+        // --- Implemented method from IFilter ---
+
+        /**
+         * @brief Push a new reading and return it, or the window median if it is an outlier
+         * 
+         * @param new_value New reading.
+         * @return int16_t Reading or replacement.
+         */
+        int16_t apply(int16_t new_value) override
+        {
+            // Step0: Seed the whole window from the first real input
+            if(count_ == 0)
+            {
+                for(uint8_t i = 0; i < Window; ++i) history_[i] = new_value;
+                head_  = 0;
+                count_ = 1;
+                return new_value;
+            }
+            if(count_ < Window) ++count_;
+
+            // Step1: Store the raw reading
+            history_[head_] = new_value;
+            if(++head_ == Window) head_ = 0;
+
+            // Step2: Median of the window
+            int16_t sorted[Window];
+            for(uint8_t i = 0; i < Window; ++i) sorted[i] = history_[i];
+            filter_utils::sortNetwork(sorted);
+            const int16_t median = sorted[Window / 2];
+
+            // Step3: MAD (uint16_t deviations so full int16_t spans cannot overflow)
+            uint16_t deviation[Window];
+            for(uint8_t i = 0; i < Window; ++i) deviation[i] = absDiff(history_[i], median);
+            filter_utils::sortNetwork(deviation);
+
+            // Step4: Threshold = max(k * 1.4826 * MAD, min deviation)
+            uint32_t threshold = (static_cast<uint32_t>(deviation[Window / 2]) * thresholdQ4_ + 8) >> 4;
+            if(threshold < minDeviation_) threshold = minDeviation_;
+
+            if(absDiff(new_value, median) > threshold)
+            {
+                if(rejected_ < UINT16_MAX) ++rejected_;
+                LOGD("HampelFilter:: rejected %d (median %d, threshold %lu)", new_value, median, (unsigned long)threshold);
+                return median;
+            }
+
+            return new_value;
+        }
+
+        /// @brief Forget the window: the next apply() seeds it again
+        void reset() override { count_ = 0; }
+
+        /// @brief True once the window only holds real readings
+        bool isSettled() const override { return count_ >= Window; }
+
+        // ----------------------------------------
+
+        /// @brief Number of readings replaced since construction (saturates)
+        uint16_t rejectedCount() const noexcept { return rejected_; }
+
+    private:
+
+        /// @brief |a - b| without int16_t overflow
+        static uint16_t absDiff(int16_t a, int16_t b)
+        {
+            return (a > b) ? static_cast<uint16_t>(static_cast<int32_t>(a) - b) : static_cast<uint16_t>(static_cast<int32_t>(b) - a);
+        }
+
+        int16_t history_[Window];   // Ring buffer with the last raw readings
+        uint8_t head_;              // Index of the oldest reading (next to overwrite)
+        uint8_t count_;             // Readings seen since seeding (saturates at Window)
+        uint16_t rejected_;         // Replaced readings (diagnostics)
+        uint8_t thresholdQ4_;       // k * 1.4826 in Q4
+        uint8_t minDeviation_;      // Minimum rejectable deviation
+
+        bool initialize_;           // To avoid reinitialization
+};
@@ -0,0 +1,99 @@
+#pragma once
+
+#include <stdint.h>
+#include "interfaces/IFilter.h"
+#include "config/Config.h"
+#include "Filter/filter_utils.h"
+#include "logger/Logger.h"
+
+
+/**
+ * @brief Fixed-point 1-D Kalman filter for temperature_x10 readings, with an optional rate state
+ * 
+ * @details
+ *  Model (one step per reading):
+ *  - Level only:     x' = x + w                      z = x + v
+ *  - Level + rate:   x' = x + r,  r' = r + w_r       z = x + v
+ *    The rate state follows a defrost ramp without the EMA steady lag (an EMA always trails a ramp by
+ *    slope/alpha), but it keeps rising after a step: 17 LSB overshoot on a 100 LSB step, 68 readings to
+ *    settle, 57 readings disturbed by a single glitch (tools/filter_bench). Hence the level-only default.
+ *  - Noise variances come from Filtering (KALMAN_MEASUREMENT_NOISE, KALMAN_PROCESS_NOISE, KALMAN_RATE_NOISE).
+ * 
+ *  Fixed-point:
+ *  - State in Q12 (x10 °C * 4096, rate in x10 °C * 4096 per reading), gains in Q15.
+ *  - The gains do not depend on the data, only on Q/R: the covariance recursion runs (in float) only until
+ *    the gains stop changing by more than one Q15 LSB, then the gains are frozen. From there each apply()
+ *    is two or three split 32x16 multiplies and some adds, no float and no division.
+ *  - Innovations are clamped to +/-2048 LSB (204.8 °C): anything bigger is a fault, not a temperature.
+ * 
+ * @example
+ *  static KalmanFilter fridgeFilter;                              // Filtering defaults: level only (EMA-like once settled)
+ *  static KalmanFilter rampFilter(4.0f, 0.01f, 0.0001f, true);    // Level + rate: ramps without lag, overshoots steps
+ */
+class KalmanFilter : public IFilter<int16_t>
+{
+    public:
+
+        /**
+         * @brief Construct a new Kalman Filter object
+         * 
+         * @param measurement_noise - R: reading noise variance in (0.1°C)^2
+         * @param process_noise - Q: level process noise variance per reading
+         * @param rate_noise - Q_rate: rate process noise variance per reading
+         * @param use_rate - true -> level + rate model (no ramp lag, overshoots steps)
+         */
+        KalmanFilter(float measurement_noise = Filtering::KALMAN_MEASUREMENT_NOISE,
+                     float process_noise     = Filtering::KALMAN_PROCESS_NOISE,
+                     float rate_noise        = Filtering::KALMAN_RATE_NOISE,
+                     bool  use_rate          = Filtering::KALMAN_USE_RATE);
+
+        /// @brief Final initialization: noise validation
+        void begin();
+
+        // --- Implemented method from IFilter ---
+
+        /**
+         * @brief Predict, then correct with the new reading
+         * 
+         * @param new_value New reading (x10 °C).
+         * @return int16_t Filtered level (x10 °C).
+         */
+        int16_t apply(int16_t new_value) override;
+
+        /// @brief Forget the state: the next apply() seeds the filter again
+        void reset() override;
+
+        /// @brief True once the gains converged and were frozen
+        bool isSettled() const override { return seeded_ && frozen_; }
+
+        // ----------------------------------------
+
+        /// @brief Estimated rate in x10 °C per reading, scaled by 4096 (0 without rate state)
+        int32_t rate_q12() const noexcept { return rate_; }
+
+    private:
+
+        /// @brief One step of the covariance recursion, updates gainLevel_/gainRate_
+        void updateGains();
+
+        static constexpr uint8_t FRAC_BITS = 12;                    // State fractional bits
+        static constexpr uint8_t STABLE_STEPS = 8;                  // Steps without gain change before freezing
+
+        float r_;                   // Measurement noise variance
+        float q_;                   // Level process noise variance
+        float qRate_;               // Rate process noise variance
+        float p00_, p01_, p11_;     // Covariance (float only while the gains are converging)
+
+        int32_t level_;             // State: level in Q12
+        int32_t rate_;              // State: rate per reading in Q12
+        int32_t gainLevel_;         // Kalman gain for the level in Q15
+        int32_t gainRate_;          // Kalman gain for the rate in Q15
+
+        bool useRate_;              // Level + rate model
+        bool seeded_;               // First reading received
+        bool frozen_;               // Gains converged, covariance recursion stopped
+        uint8_t steps_;             // Recursion steps since seeding (safety stop at 255)
+        uint8_t stableSteps_;       // Consecutive steps with unchanged gains
+
+        bool initialize_;           // To avoid reinitialization
+};
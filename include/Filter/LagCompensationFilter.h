@@ -0,0 +1,198 @@
+#pragma once
+
+#include <stdint.h>
+#include "interfaces/IFilter.h"
+#include "config/Config.h"
+#include "Filter/filter_utils.h"
+#include "logger/Logger.h"
+
+
+/**
+ * @brief Probe-lag compensation: inverse first-order thermal model
+ *
+ * @details
+ *  - A potted probe follows the air as a first-order lag:  dTp/dt = (Ta - Tp) / tau
+ *    so the air temperature is estimated from the probe readings as:
+ *      Ta = Tp + tau * dTp/dt  ->  Ta[n] = Tp[n] + (tau / dt) * D[n]
+ *    where D is the per-reading slope Tp[n] - Tp[n-1]. The correction (tau / dt) * D is smoothed with an
+ *    EMA whose time constant is 2^DerivativeShift nominal periods (weight dt / smoothing time per reading).
+ *  - dt: applyAt() (TemperatureSensor, FilterChain) measures it from the reading timestamps, so a period
+ *    change (SensorArray::setPeriod()) or readings skipped for faults retune the gain and the smoothing weight
+ *    by themselves. apply() alone assumes the nominal period (constructor / setPeriod()).
+ *  - Fixed point: gain tau/dt in Q4, weight in Q8 (two 32-bit divisions per timestamped reading),
+ *    correction in Q8: c_q8 = D * gain_q4 * 16, output = c_q8 >> 8 with a rounded shift. 32-bit math only.
+ *  - The raw slope is clamped to +/-2047 (x10 °C per reading) and the correction to +/-maxCorrection,
+ *    so a glitch can never push the estimate far from the measured value.
+ *  - The derivative amplifies noise by tau/dt: run it after the smoothing stage, e.g.
+ *      FilterChain<int16_t, ShiftEmaFilter<int16_t>, LagCompensationFilter<>> filter;
+ *  - Per probe tau: constructor argument.
+ *  - Seeds from the first input (no correction), settled once the correction EMA covered one time constant.
+ *
+ * @tparam DerivativeShift - Correction smoothing: time constant 2^DerivativeShift nominal periods (0 -> raw slope)
+ */
+template<uint8_t DerivativeShift = Filtering::LAG_DERIVATIVE_SHIFT>
+class LagCompensationFilter : public IFilter<int16_t>
+{
+    static_assert(DerivativeShift <= 8, "LagCompensationFilter: derivative shift must be <= 8");
+
+    static constexpr int32_t  SLOPE_LIMIT = 2047;       // |Tp[n] - Tp[n-1]| clamp (keeps slope * gain_q4 * 16 below 2^28)
+    static constexpr uint16_t GAIN_Q4_MAX = 4095;       // tau / dt <= 255
+    static constexpr uint16_t ONE_Q8      = 256;        // Weight 1.0 / settled threshold
+
+    public:
+
+        /**
+         * @brief Construct a new Lag Compensation Filter object
+         *
+         * @param tau_ms - Probe thermal time constant (ms)
+         * @param period_ms - Nominal time between readings (ms): smoothing time base, dt until timestamps arrive
+         * @param max_correction_x10 - Largest correction applied (x10 °C)
+         */
+        LagCompensationFilter(uint32_t tau_ms = Filtering::PROBE_TAU_COMPARTMENT_MS,
+                              uint32_t period_ms = Sampling::COMPARTMENT_PERIOD_MS,
+                              int16_t max_correction_x10 = Filtering::LAG_MAX_CORRECTION_X10):
+        tauMs_(tau_ms),
+        smoothMs_(period_ms << DerivativeShift),
+        gainQ4_(gainQ4(tau_ms, period_ms)),
+        weightQ8_(ONE_Q8 >> DerivativeShift),
+        maxCorrection_(max_correction_x10),
+        prev_(0),
+        correctionQ8_(0),
+        lastMs_(0),
+        settledQ8_(0),
+        seeded_(false),
+        initialize_(false)
+        {};
+
+        /// @brief Final initialization: tau / period / clamp validation
+        void begin()
+        {
+            if(initialize_) return;
+
+            if(gainQ4_ == 0)    LOGW("LagCompensationFilter:: tau/period gives no correction (tau %lu ms)", (unsigned long)tauMs_);
+            if(maxCorrection_ <= 0)
+            {
+                LOGW("LagCompensationFilter:: Invalid max correction %d - using %d", maxCorrection_, Filtering::LAG_MAX_CORRECTION_X10);
+                maxCorrection_ = Filtering::LAG_MAX_CORRECTION_X10;
+            }
+
+            initialize_ = true;
+        };
+
+        /// @brief New nominal period: gain and smoothing time base (keeps the state; applyAt() retunes per reading)
+        void setPeriod(uint32_t period_ms)
+        {
+            smoothMs_ = period_ms << DerivativeShift;
+            gainQ4_   = gainQ4(tauMs_, period_ms);
+            weightQ8_ = ONE_Q8 >> DerivativeShift;
+        }
+
+        // --- Implemented method from IFilter ---
+
+        /**
+         * @brief Push a probe reading taken one nominal period after the previous one
+         *
+         * @param new_value Probe reading (x10 °C).
+         * @return int16_t Estimated air temperature (x10 °C).
+         */
+        int16_t apply(int16_t new_value) override
+        {
+            // Step0: Seed from the first real input
+            if(!seeded_)
+            {
+                prev_ = new_value;
+                correctionQ8_ = 0;
+                settledQ8_ = 0;
+                seeded_ = true;
+                return new_value;
+            }
+
+            // Step1: Per-reading slope, clamped
+            int32_t slope = static_cast<int32_t>(new_value) - prev_;
+            prev_ = new_value;
+            if(slope >  SLOPE_LIMIT) slope =  SLOPE_LIMIT;
+            if(slope < -SLOPE_LIMIT) slope = -SLOPE_LIMIT;
+
+            // Step2: correction = (tau / dt) * slope in Q8, smoothed over the smoothing time, clamped
+            const int32_t delta = slope * static_cast<int32_t>(gainQ4_) * 16 - correctionQ8_;
+            correctionQ8_ += (weightQ8_ >= ONE_Q8) ? delta : filter_utils::mulQ8(delta, static_cast<uint8_t>(weightQ8_));
+            if(settledQ8_ < ONE_Q8) settledQ8_ = static_cast<uint16_t>(settledQ8_ + weightQ8_);
+
+            int32_t correction = filter_utils::roundedShift(correctionQ8_, 8);
+            if(correction >  maxCorrection_) correction =  maxCorrection_;
+            if(correction < -maxCorrection_) correction = -maxCorrection_;
+
+            // Step3: Estimate, saturated to int16_t (never the error sentinel)
+            const int32_t estimate = static_cast<int32_t>(new_value) + correction;
+            return (estimate > INT16_MAX) ? INT16_MAX : (estimate <= INT16_MIN) ? static_cast<int16_t>(INT16_MIN + 1) : static_cast<int16_t>(estimate);
+        }
+
+        /**
+         * @brief Push a probe reading with its acquisition time: dt since the previous reading sets the gain
+         *        and the smoothing weight
+         *
+         * @param new_value Probe reading (x10 °C).
+         * @param timestamp_ms millis() of the acquisition.
+         * @return int16_t Estimated air temperature (x10 °C).
+         */
+        int16_t applyAt(int16_t new_value, uint32_t timestamp_ms) override
+        {
+            if(seeded_)
+            {
+                const uint32_t dt = timestamp_ms - lastMs_;                 // Wrap-safe
+                if(dt != 0)
+                {
+                    gainQ4_   = gainQ4(tauMs_, dt);
+                    weightQ8_ = weightQ8(dt, smoothMs_);
+                }
+            }
+            lastMs_ = timestamp_ms;
+
+            return LagCompensationFilter::apply(new_value);
+        }
+
+        /// @brief Forget the state: the next apply() seeds the filter again
+        void reset() override { seeded_ = false; }
+
+        /// @brief True once the correction EMA covered one smoothing time constant since seeding
+        bool isSettled() const override { return seeded_ && settledQ8_ >= ONE_Q8; }
+
+        // ----------------------------------------
+
+        /// @brief Current tau / dt gain in Q4
+        uint16_t gain_q4() const { return gainQ4_; }
+
+        /// @brief Smoothed correction in Q8 (x10 °C, before the clamp)
+        int32_t correction_q8() const { return correctionQ8_; }
+
+    private:
+
+        /// @brief tau / dt in Q4, rounded, saturated to GAIN_Q4_MAX (period 0 -> no correction)
+        static uint16_t gainQ4(uint32_t tau_ms, uint32_t period_ms)
+        {
+            if(period_ms == 0) return 0;
+            const uint32_t gain = (tau_ms * 16u + period_ms / 2) / period_ms;
+            return (gain > GAIN_Q4_MAX) ? GAIN_Q4_MAX : static_cast<uint16_t>(gain);
+        }
+
+        /// @brief EMA weight dt / smoothing time in Q8, rounded, 1..256 (no smoothing time -> 256)
+        static uint16_t weightQ8(uint32_t dt_ms, uint32_t smooth_ms)
+        {
+            if(smooth_ms == 0 || dt_ms >= smooth_ms) return ONE_Q8;
+            const uint32_t weight = (dt_ms * ONE_Q8 + smooth_ms / 2) / smooth_ms;  // dt < smooth_ms: no overflow below ~16.7 M ms
+            return (weight == 0) ? 1 : static_cast<uint16_t>(weight);
+        }
+
+        uint32_t tauMs_;            // Probe time constant (ms)
+        uint32_t smoothMs_;         // Correction smoothing time constant (ms): 2^DerivativeShift nominal periods
+        uint16_t gainQ4_;           // tau / dt in Q4
+        uint16_t weightQ8_;         // Correction EMA weight dt / smoothMs_ in Q8 (1..256)
+        int16_t maxCorrection_;     // Correction clamp (x10 °C)
+        int16_t prev_;              // Previous probe reading
+        int32_t correctionQ8_;      // Smoothed (tau / dt) * slope in Q8 (x10 °C)
+        uint32_t lastMs_;           // Timestamp of the previous applyAt() reading
+        uint16_t settledQ8_;        // EMA weight accumulated since seeding (saturates at 256)
+        bool seeded_;               // First input received
+
+        bool initialize_;           // To avoid reinitialization
+};
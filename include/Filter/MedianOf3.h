@@ -0,0 +1,74 @@
+#pragma once
+
+#include <stdint.h>
+#include "utils/helpers.h"
+
+
+/**
+ * @brief Median-of-3 outlier rejection stage
+ * 
+ * @details
+ *  - Returns the median of the last 3 inputs: a single glitched sample never reaches the output.
+ *  - Branch-light sorting network (no buffer sort): median = max(min(a, b), min(max(a, b), c))
+ *  - Plain stage (no IFilter base, no vtable): meant to be composed with FilterChain, e.g.
+ *      FilterChain<int16_t, MedianOf3<int16_t>, ShiftEmaFilter<int16_t>>
+ *    Use FilterChain<int16_t, MedianOf3<int16_t>> to plug it alone into a TemperatureSensor.
+ *  - Seeds the 3 taps from the first input, settled once 3 real samples went through.
+ * 
+ * @tparam T - Sample type
+ */
+template<typename T>
+class MedianOf3
+{
+    public:
+
+        /// @brief Construct a new Median Of 3 stage (seeded by the first apply())
+        MedianOf3():
+        a_(0),
+        b_(0),
+        count_(0)
+        {};
+
+        /// @brief Final initialization (nothing to validate)
+        void begin() {};
+
+        /**
+         * @brief Push a new value and return the median of the last 3
+         * 
+         * @param new_value New input value.
+         * @return T Median value.
+         */
+        inline T apply(T new_value)
+        {
+            // Seed from the first real input
+            if(count_ == 0)
+            {
+                a_ = b_ = new_value;
+                count_ = 1;
+                return new_value;
+            }
+            if(count_ < 3) ++count_;
+
+            const T& lo = math::min_custom(a_, b_);
+            const T& hi = math::max_custom(a_, b_);
+            const T median = math::max_custom(lo, math::min_custom(hi, new_value));
+
+            // Shift the taps
+            a_ = b_;
+            b_ = new_value;
+
+            return median;
+        }
+
+        /// @brief Forget the taps: the next apply() seeds them again
+        void reset() { count_ = 0; }
+
+        /// @brief True once 3 real samples went through
+        bool isSettled() const { return count_ >= 3; }
+
+    private:
+
+        T a_;               // Oldest tap
+        T b_;               // Previous tap
+        uint8_t count_;     // Samples seen since seeding (saturates at 3)
+};
@@ -2,65 +2,213 @@
 
 #include "interfaces/IFilter.h"
 #include <stdint.h>
+#include "config/Config.h"
+#include "Filter/filter_utils.h"
 #include <logger/Logger.h>
 
 /**
  * @brief Applies a simple moving average (SMA) filter to a new value.
- * 
+ *
  *  - Computes the average value of a set of samples within a predetermined window:
  *  - It's usefull for smoothing out noise in the ADC converter readings
- * 
+ *
  * @details
  *  How it's works?
- *   - It calculates the average value of the last N readings 
+ *   - It calculates the average value of the last N readings
  *   - Simple Moving Average (SMA):  if you have 5 readings: [10, 12, 14, 16, 18], the SMA would be (10 + 12 + 14 + 16 + 18) / 5 = 14.
- *  
- * The formula to apply(T new_val):
- *  prev_avg + (new_val - prev_avg) / static_cast<T>(window_size);
- * 
- * @note This formula is a efficient approximation for a Simple Moving Average(SMA) without storing the full history
- * array, which make it ideal for embedded system where memoty is limited
- * @tparam T 
+ *   - The last Window samples live in a fixed-size ring buffer and a running sum is kept in a widened accumulator:
+ *       sum += new_val - oldest;  oldest = new_val;  avg = sum / Window
+ *     so every apply() is O(1) regardless of the window length.
+ *   - Window is a template parameter: for power of two windows the division becomes a shift.
+ *   - The result is rounded to nearest (no truncation bias toward zero).
+ *   - Seeding: the first apply() fills the whole window with its input, so the output is valid from the
+ *     first sample. isSettled() turns true once the window only holds real samples.
+ *
+ * @note RAM cost is Window * sizeof(T) + sizeof(accumulator). For RAM-starved builds use the
+ * approximate mode (Approximate = true) which stores a single widened value.
+ *
+ * @example
+ *  static SmaFilter<int16_t, 8> filter;            // Exact 8-sample window (16 bytes of history)
+ *  static SmaFilter<int16_t, 8, true> approx;      // EMA-like approximation, no history (4-byte state)
+ *
+ * @tparam T            Sample type
+ * @tparam Window       Number of samples in the window (> 0)
+ * @tparam Approximate  true -> stateless approximation (see specialization below)
  */
-template<typename T>
-class SmaFilter: public IFilter
+template<typename T, uint8_t Window = Filtering::SMA_WINDOW_DEFAULT, bool Approximate = false>
+class SmaFilter: public IFilter<T>
 {
+    static_assert(Window > 0, "SmaFilter: window size must be > 0");
+
+    using Acc = typename filter_utils::Accumulator<T>::type;
+
     public:
 
         /**
          * @brief Construct a new Sma Filter object
-         * 
-         * @param initial_value initial value for seeding
-         * @param window -window size must be > 0
+         *
+         * @note The window is seeded by the first apply()
          */
-        SmaFilter(T initial_value, uint8_t window):
-        window_(window),
-        prev_avg_(initial_value)
-        {
-           
-        };
+        SmaFilter():
+        history_{},
+        sum_(0),
+        head_(0),
+        count_(0),
+        initialize_(false)
+        {};
 
         /**
-         * @brief Final initialization: window size validation
-         * 
+         * @brief Final initialization
+         *
          */
         void begin()
         {
             // Skip if already initialize
             if(initialize_) return;
 
-            // Validate and fallback window input
-            if (window == 0)
+            LOGD("SmaFilter:: window = %d", Window);
+
+            initialize_ = true;
+        };
+
+        // --- Implemented method from IFilter ---
+
+        /**
+         * @brief Push a new value into the window and return the rounded average
+         *
+         * @param new_value New input value.
+         * @return T Filtered value.
+         */
+        T apply(T new_value) override
+        {
+            // Step0: Seed the whole window from the first real input
+            if(count_ == 0)
             {
-                LOGW("Invalid SMA window size: %d - Setting to 1", window);
-                window_ =1;
+                for(uint8_t i = 0; i < Window; ++i) history_[i] = new_value;
+                sum_   = static_cast<Acc>(new_value) * Window;
+                head_  = 0;
+                count_ = 1;
+                return new_value;
             }
+            if(count_ < Window) ++count_;
+
+            // Step1: Replace the oldest sample in the running sum
+            sum_ += static_cast<Acc>(new_value) - static_cast<Acc>(history_[head_]);
+            history_[head_] = new_value;
+
+            // Step2: Advance the ring index (no modulo)
+            if(++head_ == Window) head_ = 0;
+
+            // Step3: Average (shift for power of two windows)
+            return static_cast<T>(filter_utils::roundedDivide<Window>(sum_));
+        }
+
+        /// @brief Forget the window: the next apply() seeds it again
+        void reset() override { count_ = 0; }
+
+        /// @brief True once Window real samples went through the filter
+        bool isSettled() const override { return count_ >= Window; }
+
+        // ----------------------------------------
+
+    private:
+
+        T history_[Window];     // Ring buffer with the last Window samples
+        Acc sum_;               // Running sum of history_ (widened)
+        uint8_t head_;          // Index of the oldest sample (next to overwrite)
+        uint8_t count_;         // Samples seen since seeding (saturates at Window)
+
+        bool initialize_;       // State: to avoid reinitialization
+};
+
+
+/**
+ * @brief Approximate SMA without history (RAM-starved builds)
+ *
+ * @details
+ *  The formula to apply(T new_val):
+ *   prev_avg + (new_val - prev_avg) / Window;
+ *  - Integral samples: the state keeps Filtering::EMA_FRAC_BITS extra fractional bits (as ShiftEmaFilter does),
+ *    so a step smaller than Window/2 LSB still moves it. With a plain T state the rounded delta / Window is 0
+ *    for delta in [-Window/2, Window/2 - 1]: the output would stick up to Window/2 LSB away from the input.
+ *
+ * @note This formula is a efficient approximation for a Simple Moving Average(SMA) without storing the full history
+ * array, which make it ideal for embedded system where memoty is limited. It behaves like an EMA with alpha = 1/Window,
+ * so it is not a true windowed average (old samples never fully leave the state).
+ * Seeds from the first input and reports settled after Window samples.
+ */
+template<typename T, uint8_t Window>
+class SmaFilter<T, Window, true>: public IFilter<T>
+{
+    static_assert(Window > 0, "SmaFilter: window size must be > 0");
+    static_assert(static_cast<T>(-1) < static_cast<T>(0), "SmaFilter: approximate mode needs a signed sample type");
+
+    using Acc = typename filter_utils::Accumulator<T>::type;
+
+    // State scale: 2^EMA_FRAC_BITS for integral samples (no dead band), 1 for floating point
+    static constexpr uint32_t SCALE = filter_utils::Accumulator<T>::integral ? (1ul << Filtering::EMA_FRAC_BITS) : 1ul;
+    static_assert(!filter_utils::Accumulator<T>::integral || SCALE >= Window, "SmaFilter: Filtering::EMA_FRAC_BITS too small for this window");
+
+    public:
+
+        /**
+         * @brief Construct a new approximate Sma Filter object
+         *
+         * @note The state is seeded by the first apply()
+         */
+        SmaFilter():
+        prev_avg_(0),
+        count_(0),
+        initialize_(false)
+        {};
+
+        /// @brief Final initialization
+        void begin()
+        {
+            if(initialize_) return;
+
+            LOGD("SmaFilter:: approximate mode, window = %d", Window);
+
+            initialize_ = true;
         };
-    
+
+        // --- Implemented method from IFilter ---
+
+        /**
+         * @brief Move the average 1/Window of the way toward the new value
+         *
+         * @param new_value New input value.
+         * @return T Filtered value.
+         */
+        T apply(T new_value) override
+        {
+            const Acc target = static_cast<Acc>(new_value) * static_cast<Acc>(SCALE);
+
+            // Seed from the first real input
+            if(count_ == 0)
+            {
+                count_ = 1;
+                prev_avg_ = target;
+                return new_value;
+            }
+            if(count_ < Window) ++count_;
+
+            prev_avg_ += filter_utils::roundedDivide<Window>(static_cast<Acc>(target - prev_avg_));
+            return static_cast<T>(filter_utils::roundedDivide<SCALE>(prev_avg_));
+        }
+
+        /// @brief Forget the state: the next apply() seeds it again
+        void reset() override { count_ = 0; }
+
+        /// @brief True once Window samples went through the filter
+        bool isSettled() const override { return count_ >= Window; }
+
+        // ----------------------------------------
+
     private:
 
-        uint8_t window_;        // This the effective "memory" length
-        T prev_avg_;            // State: stores the approximated avg
+        Acc prev_avg_;          // State: approximated avg scaled by SCALE
+        uint8_t count_;         // Samples seen since seeding (saturates at Window)
 
         bool initialize_;       // State: to avoid reinitialization
-};
\ No newline at end of file
+};
@@ -0,0 +1,195 @@
+#pragma once
+
+#include <stdint.h>
+
+/**
+ * @brief Compile-time helpers shared by the filter implementations
+ * 
+ * @details
+ *  - No <type_traits> on AVR: the few traits the filters need are spelled out here.
+ *  - Everything is constexpr/inline so it folds away when the window/shift are template parameters.
+ */
+namespace filter_utils
+{
+    /**
+     * @brief Widened accumulator type used to sum N samples of T without overflow
+     * 
+     * @tparam T - Sample type
+     */
+    template<typename T> struct Accumulator           { using type = int32_t;  static constexpr bool integral = true;  };
+    template<>           struct Accumulator<uint8_t>  { using type = uint16_t; static constexpr bool integral = true;  };
+    template<>           struct Accumulator<uint16_t> { using type = uint32_t; static constexpr bool integral = true;  };
+    template<>           struct Accumulator<uint32_t> { using type = uint64_t; static constexpr bool integral = true;  };
+    template<>           struct Accumulator<int32_t>  { using type = int64_t;  static constexpr bool integral = true;  };
+    template<>           struct Accumulator<float>    { using type = float;    static constexpr bool integral = false; };
+    template<>           struct Accumulator<double>   { using type = double;   static constexpr bool integral = false; };
+
+    /// @brief Same type check (no <type_traits> on AVR)
+    template<typename A, typename B> struct IsSame       { static constexpr bool value = false; };
+    template<typename A>             struct IsSame<A, A> { static constexpr bool value = true;  };
+
+    /**
+     * @brief True when Stage itself declares T applyAt(T, uint32_t) (inherited IFilter::applyAt does not count)
+     */
+    template<typename Stage, typename T, typename = void>
+    struct HasOwnApplyAt { static constexpr bool value = false; };
+
+    template<typename Stage, typename T>
+    struct HasOwnApplyAt<Stage, T, decltype(void(&Stage::applyAt))>
+    {
+        static constexpr bool value = IsSame<decltype(&Stage::applyAt), T (Stage::*)(T, uint32_t)>::value;
+    };
+
+    /**
+     * @brief Call a stage on its exact type with the sample timestamp when it models time, plain apply() otherwise
+     * 
+     * @param stage        - Concrete filter stage
+     * @param value        - New input value
+     * @param timestamp_ms - millis() of the acquisition
+     * @return T           - Stage output
+     */
+    template<typename Stage, typename T>
+    inline T applyAt(Stage& stage, T value, uint32_t timestamp_ms)
+    {
+        if constexpr (HasOwnApplyAt<Stage, T>::value) return static_cast<T>(stage.Stage::applyAt(value, timestamp_ms));
+        else                                         { (void)timestamp_ms; return static_cast<T>(stage.Stage::apply(value)); }
+    }
+
+    /// @brief True if n is a power of two (n > 0)
+    constexpr bool isPowerOfTwo(uint32_t n) { return n && !(n & (n - 1)); }
+
+    /// @brief floor(log2(n)) for n > 0 (log2 of a power of two window)
+    constexpr uint8_t log2Floor(uint32_t n) { return (n <= 1) ? 0 : static_cast<uint8_t>(1 + log2Floor(n >> 1)); }
+
+    /**
+     * @brief Divide by a compile-time constant rounding to nearest
+     * 
+     * @details
+     *  - Plain integer division truncates toward zero, which biases a filter output toward 0 by up to 1 LSB.
+     *  - Ties: signed values with a power of two divisor round up (toward +inf, e.g. -2.5 -> -2): a shift
+     *    with a half-LSB offset (arithmetic shift). Other signed divisors round ties away from zero,
+     *    unsigned values round ties up.
+     *  - Floating point accumulators are divided as is.
+     * 
+     * @tparam Divisor - Constant divisor (> 0)
+     * @tparam Acc     - Accumulator type
+     * @param value    - Value to divide
+     * @return Acc     - Rounded quotient
+     */
+    template<uint32_t Divisor, typename Acc>
+    inline Acc roundedDivide(Acc value)
+    {
+        static_assert(Divisor > 0, "roundedDivide(): divisor must be > 0");
+
+        if constexpr (!(static_cast<Acc>(1) / 2 == 0))
+        {
+            return value / static_cast<Acc>(Divisor);                         // Floating point
+        }
+        else if constexpr (Divisor == 1)
+        {
+            return value;
+        }
+        else if constexpr (static_cast<Acc>(-1) > 0)
+        {
+            return static_cast<Acc>((value + static_cast<Acc>(Divisor >> 1)) / static_cast<Acc>(Divisor)); // Unsigned: shift for powers of two
+        }
+        else if constexpr (isPowerOfTwo(Divisor))
+        {
+            // Arithmetic shift: rounds half up, symmetric enough for sensor data and much cheaper than a division
+            return static_cast<Acc>((value + static_cast<Acc>(Divisor >> 1)) >> log2Floor(Divisor));
+        }
+        else
+        {
+            const Acc half = static_cast<Acc>(Divisor >> 1);
+            return (value < 0) ? static_cast<Acc>((value - half) / static_cast<Acc>(Divisor))
+                               : static_cast<Acc>((value + half) / static_cast<Acc>(Divisor));
+        }
+    }
+
+    /**
+     * @brief Arithmetic right shift with rounding to nearest (half up)
+     * 
+     * @param value - Signed fixed-point value
+     * @param shift - Fractional bits to drop (> 0)
+     * @return int32_t - Rounded value
+     */
+    inline int32_t roundedShift(int32_t value, uint8_t shift)
+    {
+        return (shift == 0) ? value : ((value + (static_cast<int32_t>(1) << (shift - 1))) >> shift);
+    }
+
+    /// @brief Compare-exchange: after the call a <= b
+    template<typename T>
+    inline void compareExchange(T& a, T& b)
+    {
+        if(b < a) { const T t = a; a = b; b = t; }
+    }
+
+    /**
+     * @brief Sort a small array in place with a fixed sorting network (N = 3, 5 or 7)
+     * 
+     * @details Fixed sequence of compare-exchanges: no loops, no data dependent control flow apart
+     *          from the swaps, constant time. 3 -> 3 comparators, 5 -> 9, 7 -> 16.
+     * 
+     * @tparam N - Array size
+     * @tparam T - Element type
+     * @param v  - Array to sort (ascending)
+     */
+    template<uint8_t N, typename T>
+    inline void sortNetwork(T (&v)[N])
+    {
+        static_assert(N == 3 || N == 5 || N == 7, "sortNetwork(): only 3, 5 or 7 elements");
+
+        if constexpr (N == 3)
+        {
+            compareExchange(v[0], v[1]); compareExchange(v[1], v[2]); compareExchange(v[0], v[1]);
+        }
+        else if constexpr (N == 5)
+        {
+            compareExchange(v[0], v[1]); compareExchange(v[3], v[4]); compareExchange(v[2], v[4]);
+            compareExchange(v[2], v[3]); compareExchange(v[0], v[3]); compareExchange(v[0], v[2]);
+            compareExchange(v[1], v[4]); compareExchange(v[1], v[3]); compareExchange(v[1], v[2]);
+        }
+        else
+        {
+            compareExchange(v[0], v[6]); compareExchange(v[2], v[3]); compareExchange(v[4], v[5]);
+            compareExchange(v[0], v[2]); compareExchange(v[1], v[4]); compareExchange(v[3], v[6]);
+            compareExchange(v[0], v[1]); compareExchange(v[2], v[5]); compareExchange(v[3], v[4]);
+            compareExchange(v[1], v[2]); compareExchange(v[4], v[6]); compareExchange(v[2], v[3]);
+            compareExchange(v[4], v[5]); compareExchange(v[1], v[2]); compareExchange(v[3], v[4]);
+            compareExchange(v[5], v[6]);
+        }
+    }
+
+    /**
+     * @brief Multiply a fixed-point value by a Q8 weight with rounding: round(value * weight / 256)
+     * 
+     * @details Split in high/low bytes so it never overflows int32_t (no 32x8 -> 40 bit product):
+     *          value * weight / 256 = (value >> 8) * weight + ((value & 0xFF) * weight) / 256
+     * 
+     * @param value  - Signed fixed-point value
+     * @param weight - Q8 weight (0..255)
+     * @return int32_t - Rounded product in the format of value
+     */
+    inline int32_t mulQ8(int32_t value, uint8_t weight)
+    {
+        return (value >> 8) * weight + ((static_cast<int32_t>(value & 0xFF) * weight + 128) >> 8);
+    }
+
+    /**
+     * @brief Multiply a fixed-point value by a Q15 gain with rounding: round(value * gain / 2^15)
+     * 
+     * @details The product is split in high/low bytes so no 64-bit multiply is needed on AVR:
+     *          value * gain / 2^8 = (value >> 8) * gain + ((value & 0xFF) * gain) / 2^8
+     * 
+     * @param value - Signed fixed-point value, |value| < 2^23
+     * @param gain  - Q15 gain, |gain| <= 2^15 (1.0)
+     * @return int32_t - Rounded product in the format of value
+     */
+    inline int32_t mulQ15(int32_t value, int32_t gain)
+    {
+        const int32_t q8 = (value >> 8) * gain + (((value & 0xFF) * gain) >> 8);   // value * gain / 2^8
+        return roundedShift(q8, 7);
+    }
+
+} // namespace filter_utils
@@ -17,6 +17,10 @@
  *  - Applies a setting delay to stabilize the signal.
  *  - Discard the N first readings to flush artifact.
  *  - Average multiple ADC reading to reduce noise.
+ *  - Split-phase mode (startSample()/pollSample()): same pipeline driven by the ADC registers, one conversion
+ *    step per poll, settling delays measured with micros() instead of busy waiting.
+ *    Several AdcSamplers share the single ADC: a pending acquisition waits until the owner finishes
+ *    (or drops its acquisition with cancelSample()).
  *  
  */
 class AdcSampler : public ISampler
@@ -36,12 +40,34 @@ class AdcSampler : public ISampler
         /// @return ADC raw count value 
         uint16_t sample() override;
 
+        /// @brief Start a non-blocking acquisition (discard + average, same as sample())
+        void startSample() override;
+
+        /// @brief Advance the non-blocking acquisition
+        /// @return true when adc_raw holds the averaged value
+        bool pollSample(uint16_t& adc_raw) override;
+
+        /// @brief Abandon the pending acquisition and release the ADC if this sampler owns it
+        void cancelSample() override;
+
     private:
 
+        /// @brief Average (rounded) and clamp the accumulated samples
+        uint16_t average(uint32_t accumulated) const noexcept;
+
         const uint8_t pin_;                 // Analog pin to read
         const uint8_t samples_per_read_;     //K consecutive ADC reads for averaging, use power of 2 for fast division
         const uint8_t discard_N_first_;     // Discard the N first sample reading       
         const uint8_t settleUs_;            // Microseconds delay after each each for stability
 
+        // Split-phase state
+        uint32_t accumulated_;              // Sum of the averaged conversions so far
+        uint8_t  conversionsLeft_;          // Conversions still to run (discarded ones included)
+        uint16_t lastConversionUs_;         // micros() at the end of the last conversion (settling)
+        bool pending_;                      // Acquisition started and not yet returned
+        bool converting_;                   // A conversion is running on the ADC
+
+        static AdcSampler* owner_;          // Sampler currently driving the ADC in split-phase mode
+
         bool initialize_;                   // To avoid re-configuration
 };
\ No newline at end of file
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "config/Config.h"
+#include "interfaces/ISampler.h"
+#include "Filter/CicDecimator.h"
+#include "logger/Logger.h"
+
+/**
+ * @brief Free-running, interrupt-driven ADC sampler with CIC decimation
+ * 
+ * @details
+ *  what this class does?
+ *  - Implement the ISampler interface for a single analog pin.
+ *  - Runs the ADC in free-running mode (prescaler 128 -> ~9.6 kHz) with the ADC_vect interrupt enabled.
+ *  - The ISR feeds every conversion to a CicDecimator<Adc::CIC_ORDER, Adc::CIC_DECIMATION>: a few 32-bit adds per
+ *    conversion, so the whole ADC stream is used (anti-aliased + averaged) instead of short blocking bursts.
+ *  - sample() returns the latest decimated value scaled back to ADC counts: no blocking acquisition, no settling delay.
+ * 
+ * @note The CIC sampler owns the ADC while running: analogRead() (AdcSampler) must not be used until stop().
+ *       Only one CicAdcSampler can be active at a time.
+ * 
+ * @example
+ *  static CicAdcSampler sampler(Pins::COMPARTMENT_NTC_ADC_PIN);
+ *  sampler.begin();                    // after analogReference() (begin() programs it with a throwaway analogRead())
+ *  sensor.addSampler(&sampler);
+ */
+class CicAdcSampler : public ISampler
+{
+    public:
+
+        using Decimator = CicDecimator<Adc::CIC_ORDER, Adc::CIC_DECIMATION, Adc::BIT_RESOLUTION>;
+
+        /// @brief Configurable: analog pin
+        explicit CicAdcSampler(uint8_t adc_pin);
+
+        /// @brief Final initialization: claims the ADC and starts free-running conversions
+        void begin();
+
+        /// @brief Stops the free-running ADC and releases it (analogRead() usable again)
+        void stop();
+
+        // === Implemented method from ISampler interface ===
+
+        /// @brief Latest decimated sample (waits only for the very first output after begin(), bounded)
+        /// @return ADC raw count value (Adc::INVALID_SAMPLE if the sampler is not running)
+        uint16_t sample() override;
+
+        /// @brief Non-blocking read: ready as soon as the decimator produced its first output
+        bool pollSample(uint16_t& adc_raw) override;
+
+        /// @brief ISR hook: feed one conversion to the decimator
+        inline void onConversion(uint16_t raw)
+        {
+            if(cic_.push(raw))
+            {
+                latest_ = cic_.output();
+                fresh_  = true;
+            }
+        }
+
+        /// @brief Sampler currently attached to ADC_vect (nullptr when none)
+        static CicAdcSampler* active() { return active_; }
+
+    private:
+
+        const uint8_t pin_;                 // Analog pin to read
+        Decimator cic_;                     // Decimator (ISR side)
+        volatile uint32_t latest_;          // Last decimated output, full precision (written by the ISR)
+        volatile bool fresh_;               // At least one primed output since begin()
+
+        static CicAdcSampler* volatile active_;    // Owner of the ADC interrupt
+
+        bool initialize_;                   // To avoid re-configuration
+};
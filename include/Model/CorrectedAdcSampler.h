@@ -0,0 +1,64 @@
+#pragma once
+
+#include<stdint.h>
+
+#include "config/Config.h"
+#include "interfaces/ISampler.h"
+#include "data/adc_correction.h"
+#include "logger/Logger.h"
+
+/**
+ * @brief ISampler decorator that applies a per-board ADC INL/DNL correction curve
+ * 
+ * @details
+ *  what this class does?
+ *  - Wraps any ISampler (AdcSampler, DualPullupAdcSampler, ...) and corrects its averaged raw value
+ *    before it reaches the IResistanceConverter.
+ *  - The correction curve lives in flash (see data/adc_correction.h) and is piecewise linear between
+ *    evenly spaced knots, so the lookup is a shift + mask + one small multiply (no division, no search).
+ *  - Much cheaper than averaging more samples to hide the nonlinearity, and it makes probes agree across boards.
+ * 
+ * @example
+ *  static AdcSampler rawSampler(Pins::COMPARTMENT_NTC_ADC_PIN, ...);
+ *  static CorrectedAdcSampler sampler(&rawSampler);            // Uses ADC_INL_CORRECTION
+ *  sensor.addSampler(&sampler);
+ */
+class CorrectedAdcSampler : public ISampler
+{
+    public:
+
+        /// @brief Wrap a sampler with a PROGMEM correction curve of Adc::CORRECTION_KNOTS entries
+        /// @param sampler - Sampler that provides the raw averaged ADC value
+        /// @param correction_P - PROGMEM pointer to the correction curve (defaults to the board curve)
+        CorrectedAdcSampler(ISampler* sampler, const int8_t* correction_P = ADC_INL_CORRECTION);
+
+        /// @brief Final initialization: validation
+        void begin();
+
+        // === Implemented method from ISampler interface ===
+
+        /// @brief Samples through the wrapped sampler and corrects the result
+        /// @return Corrected ADC raw count value (Adc::INVALID_SAMPLE without a wrapped sampler)
+        uint16_t sample() override;
+
+        /// @brief Start a non-blocking acquisition on the wrapped sampler
+        void startSample() override;
+
+        /// @brief Advance the wrapped acquisition, correct the result once ready
+        bool pollSample(uint16_t& adc_raw) override;
+
+        /// @brief Abandon the wrapped acquisition
+        void cancelSample() override;
+
+        /// @brief Correct a raw ADC code with the configured curve (pure computation)
+        /// @param adc_raw - Raw ADC counts
+        /// @return Corrected ADC counts
+        uint16_t correct(uint16_t adc_raw) const noexcept;
+
+    private:
+
+        ISampler* sampler_;             // Wrapped sampler
+        const int8_t* correction_P_;    // PROGMEM correction curve
+
+        bool initialize_;               // To avoid re-configuration
+};
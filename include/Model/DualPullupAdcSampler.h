@@ -0,0 +1,80 @@
+#pragma once
+
+#include<stdint.h>
+
+#include "config/Config.h"
+#include "interfaces/ISampler.h"
+#include "Model/AdcSampler.h"
+#include "logger/Logger.h"
+
+/**
+ * @brief Pullup selected on the auto-ranging voltage divider
+ * 
+ *  - Low:  GPIO driven HIGH, switched pullup in parallel with the fixed one (small effective pullup, warm end)
+ *  - High: GPIO in Hi-Z, only the fixed pullup is connected (big effective pullup, cold end)
+ */
+enum class PullupRange : uint8_t
+{
+    Low,
+    High
+};
+
+/**
+ * @brief Auto-ranging ADC sampler for a dual pullup voltage divider
+ * 
+ * @details
+ *  what this class does?
+ *  - Implement the ISampler interface on top of an AdcSampler (same discard/settle/average pipeline).
+ *  - Drives a second pullup through a GPIO: OUTPUT HIGH connects it, INPUT (Hi-Z) disconnects it.
+ *  - Keeps the junction inside [Adc::RANGE_SWITCH_LOW_COUNTS, Adc::RANGE_SWITCH_HIGH_COUNTS] by swapping
+ *    range and re-sampling only when the reading leaves that window (no extra oversampling at steady state).
+ *  - Exposes the range used for the last sample so the VoltageDividerResistanceConverter applies the matching pullup.
+ * 
+ * @example
+ *  static DualPullupAdcSampler sampler(Pins::EVAPORATOR_NTC_ADC_PIN, Pins::EVAPORATOR_PULLUP_SWITCH_PIN,
+ *                                      Adc::SAMPLES_TO_AVERAGE, Adc::SAMPLES_TO_DISCARD, Adc::SETTLE_TIME_US);
+ *  static VoltageDividerResistanceConverter converter(Sensors::PULLUP_HIGH_RANGE_OHMS, Sensors::PULLUP_SWITCHED_OHMS, &sampler);
+ */
+class DualPullupAdcSampler : public ISampler
+{
+    public:
+
+        /// @brief Configurable: ADC pin, pullup switch GPIO, samples to average, samples to discard and settle time
+        DualPullupAdcSampler(uint8_t adc_pin, uint8_t switch_pin, uint8_t samples_to_average, uint8_t samples_to_discard, uint8_t settle_us);
+
+        /// @brief Final initialization: ADC sampler setup and initial range (High, safe for an unknown/cold probe)
+        void begin();
+
+        // === Implemented method from ISampler interface ===
+
+        /// @brief Samples the junction on the current range, switching range first if it falls outside the window
+        /// @return ADC raw count value measured with range()
+        uint16_t sample() override;
+
+        /// @brief Start a non-blocking acquisition on the current range
+        void startSample() override;
+
+        /// @brief Advance the acquisition, switching range and restarting once if the junction left the window
+        bool pollSample(uint16_t& adc_raw) override;
+
+        /// @brief Abandon the pending acquisition (the range stays as it is)
+        void cancelSample() override;
+
+        /// @brief Range that was used to acquire the last sample
+        PullupRange range() const noexcept { return range_; }
+
+    private:
+
+        /// @brief Drive the switch GPIO for the requested range
+        void selectRange(PullupRange range);
+
+        /// @brief True when raw is outside the window of the current range (a range swap is needed)
+        bool outOfWindow(uint16_t raw) const noexcept;
+
+        AdcSampler adc_;                    // Discard/settle/average pipeline on the junction pin
+        const uint8_t switchPin_;           // GPIO that drives the switched pullup
+        PullupRange range_;                 // Range currently applied to the divider
+        bool switched_;                     // Split-phase: range already swapped for the pending acquisition
+
+        bool initialize_;                   // To avoid re-configuration
+};
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "interfaces/IResistanceConverter.h"    // Abstract interface (usable from the fluent TemperatureSensor too)
+#include "config/Config.h"                      // Centralize configuration params
+#include "logger/Logger.h"                      // For debugging
+
+
+/**
+ * @brief Voltage divider ADC -> Resistance conversion with the pullup fixed at compile time
+ *
+ * @details
+ *  Same circuit and formula as VoltageDividerResistanceConverter:
+ *      R_NTC_x10 = (adc_raw * PullupOhms * 10) / (ADC_max - adc_raw)
+ *  but the pullup is a template parameter, so PullupOhms * 10 is a compile-time constant the compiler can fold
+ *  into the multiply (TemperatureSensorT calls it without virtual dispatch and inlines the whole conversion).
+ *  - Header-only and stateless: one instance can serve every sensor on the same divider.
+ *  - adc_raw == 0 (shorted NTC) and adc_raw >= ADC_max (open NTC, zero denominator) return 0 (invalid).
+ *
+ * @example
+ *  static FixedPullupResistanceConverter<Sensors::PULLUP_FIXED_RESISTOR_OHMS> res_converter;
+ *  uint32_t r_x10 = res_converter.convertToResistance_x10(adc_raw);
+ *
+ * @tparam PullupOhms - Fixed resistance connected to V_REF
+ */
+template<uint32_t PullupOhms = Sensors::PULLUP_FIXED_RESISTOR_OHMS>
+class FixedPullupResistanceConverter : public IResistanceConverter
+{
+    static_assert(PullupOhms > 0, "FixedPullupResistanceConverter: pullup must be > 0 Ohms");
+    static_assert(PullupOhms <= UINT32_MAX / 10u / (Adc::MAX_VALUE - 1u),
+                  "FixedPullupResistanceConverter: adc_raw * pullup * 10 overflows 32 bits");
+
+    public:
+
+        /// @brief Final initialization (nothing to validate: checked at compile time)
+        void begin()
+        {
+            LOGD_SENSOR("FixedPullupResistanceConverter:: pullup = %lu Ohms", (unsigned long)PullupOhms);
+        };
+
+        // --- Implemented methods from IResistanceConverter interface ---
+
+        /// @brief Convert to a resistance value scaled by 10 for 0.1Ω resolution
+        /// @param adc_raw - Raw ADC counts(0 - 1023 for 10bits resolution)
+        /// @return Resistance in 0.1Ω resolution (x10), 0 when adc_raw is out of the measurable range
+        uint32_t convertToResistance_x10(uint16_t adc_raw) override
+        {
+            return toResistance_x10(adc_raw);
+        }
+
+        /// @brief Pure conversion (constexpr: usable to precompute thresholds)
+        static constexpr uint32_t toResistance_x10(uint16_t adc_raw) noexcept
+        {
+            return (adc_raw == 0 || adc_raw >= Adc::MAX_VALUE)
+                ? 0
+                : (static_cast<uint32_t>(adc_raw) * (PullupOhms * 10u)) / (Adc::MAX_VALUE - adc_raw);
+        }
+
+        /// @brief Pullup in Ohms
+        static constexpr uint32_t pullupOhms() noexcept { return PullupOhms; }
+};
@@ -40,6 +40,14 @@ public:
      */
     int16_t convertToTemperature_x10(uint32_t resistance_x10) const noexcept override;
 
+    /**
+     * @brief Same conversion, keeping whether the LUT clamped the result
+     * 
+     * @param resistance_x10 Resistance in tenths of Ohms
+     * @return TemperatureResult Temperature (0.1 °C) + Ok / BelowTable / AboveTable / ConversionError
+     */
+    TemperatureResult convertToTemperature(uint32_t resistance_x10) const noexcept override;
+
 private:
     bool initialize_;
 };
@@ -0,0 +1,208 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "config/Config.h"
+#include "Model/Reading.h"
+#include "logger/Logger.h"
+
+
+/**
+ * @brief Least-squares rate of change (x10 °C per minute) over a sliding window of timestamped readings
+ *
+ * @details
+ *  - Fits x = a + b * t over the last window() readings and returns b, using the running sums
+ *      n, St, Sx, Stt, Stx   ->   b = (n * Stx - St * Sx) / (n * Stt - St * St)
+ *    Readings may be unevenly spaced (period changes, skipped faults): the real timestamps are used.
+ *  - O(1) per push: the evicted reading is subtracted from the sums, then the time origin moves to the new
+ *    oldest reading with the exact identities (d = shift of the origin)
+ *      St' = St - n*d     Stt' = Stt - 2*d*St + n*d*d     Stx' = Stx - d*Sx
+ *    so every sum stays small enough for 32-bit integers (no rescan, no float).
+ *  - Fixed point: time in units of 2^Sampling::RATE_TIME_SHIFT ms, at most RATE_MAX_SPAN units between the
+ *    oldest and newest reading (older readings are evicted first); values relative to the first reading after
+ *    clear(), clamped to +/-RATE_MAX_DELTA_X10. The final division is done in 64-bit, once per query.
+ *  - RAM: Capacity * 4 bytes + 26 bytes, e.g. 90 bytes for 16 slots.
+ *
+ * @example
+ *  static RateEstimator<Sampling::RATE_WINDOW> evaporatorRate;        // One per sensor
+ *  evaporatorRate.push(sensors.reading(EVAPORATOR));                  // Readings without value are skipped
+ *  if(evaporatorRate.isReady() && evaporatorRate.rate_x10_per_min() > 20) ... // Warming faster than 2.0 °C/min
+ *
+ * @tparam Capacity - Maximum window in readings (2..64)
+ */
+template<uint8_t Capacity = Sampling::RATE_WINDOW>
+class RateEstimator
+{
+    static_assert(Capacity >= 2 && Capacity <= 64, "RateEstimator: capacity must be 2..64 (32-bit running sums)");
+
+    public:
+
+        static constexpr uint16_t RATE_MAX_SPAN      = 4095;    // Oldest..newest reading in time units (Capacity * 4095^2 < 2^31)
+        static constexpr int16_t  RATE_MAX_DELTA_X10 = 2047;    // |value - first value| clamp (Capacity * 4095 * 2047 < 2^31)
+
+        /// @brief Construct an empty estimator using the whole capacity as window
+        RateEstimator():
+        values_{},
+        times_{},
+        sumT_(0),
+        sumTT_(0),
+        sumX_(0),
+        sumTX_(0),
+        lastMs_(0),
+        baseX_(0),
+        window_(Capacity),
+        head_(0),
+        count_(0)
+        {};
+
+        /// @brief Change the window (clamped to 2..Capacity); clears the estimator
+        void setWindow(uint8_t window)
+        {
+            if(window < 2 || window > Capacity)
+            {
+                LOGW("RateEstimator:: window %u out of 2..%u, clamping", window, Capacity);
+                window = (window < 2) ? 2 : Capacity;
+            }
+            window_ = window;
+            clear();
+        }
+
+        /// @brief Forget every reading
+        void clear()
+        {
+            sumT_ = sumTT_ = 0;
+            sumX_ = sumTX_ = 0;
+            head_ = 0;
+            count_ = 0;
+        }
+
+        /**
+         * @brief Append a timestamped temperature, evicting the oldest ones (window full / span exceeded)
+         *
+         * @param value_x10 - Temperature in 0.1°C
+         * @param timestamp_ms - millis() of the reading (wrap-around safe)
+         */
+        void push(int16_t value_x10, uint32_t timestamp_ms)
+        {
+            const uint16_t now = static_cast<uint16_t>(timestamp_ms >> Sampling::RATE_TIME_SHIFT);
+
+            // Step1: A gap longer than the span makes the whole window stale (also keeps the 16-bit times unambiguous)
+            if(count_ != 0 && (timestamp_ms - lastMs_) > (static_cast<uint32_t>(RATE_MAX_SPAN) << Sampling::RATE_TIME_SHIFT)) clear();
+            lastMs_ = timestamp_ms;
+
+            // Step2: Evict the oldest readings while the window is full or the new one is too far away
+            while(count_ != 0 && (count_ == window_ || static_cast<uint16_t>(now - oldestTime()) > RATE_MAX_SPAN))
+            {
+                evictOldest();
+            }
+            if(count_ == 0) baseX_ = value_x10;     // Empty window: the value origin restarts here
+
+            // Step3: Store the reading (time relative to the oldest one, value relative to baseX_)
+            int32_t x = static_cast<int32_t>(value_x10) - baseX_;
+            if(x >  RATE_MAX_DELTA_X10) x =  RATE_MAX_DELTA_X10;
+            if(x < -RATE_MAX_DELTA_X10) x = -RATE_MAX_DELTA_X10;
+
+            const uint8_t slot = slotOf(count_);
+            values_[slot] = static_cast<int16_t>(x);
+            times_[slot] = now;
+            ++count_;
+
+            const uint32_t t = static_cast<uint16_t>(now - oldestTime());
+            sumT_  += t;
+            sumTT_ += t * t;
+            sumX_  += x;
+            sumTX_ += static_cast<int32_t>(t) * x;
+        }
+
+        /**
+         * @brief Append the filtered temperature of a reading, at its acquisition time
+         *
+         * @return true if stored, false if the reading had no value (fault)
+         */
+        bool push(const Reading& reading)
+        {
+            if(!reading.hasValue()) return false;
+            push(reading.temperature_x10, reading.timestamp_ms);
+            return true;
+        }
+
+        /// @brief True when the fit is defined (>= 2 readings at different times)
+        bool isReady() const { return count_ >= 2 && denominator() > 0; }
+
+        /**
+         * @brief Least-squares slope of the window, rounded to nearest and saturated to int16_t
+         *
+         * @return int16_t Rate in 0.1°C per minute (Sensors::INVALID_READING_X10 while !isReady())
+         */
+        int16_t rate_x10_per_min() const
+        {
+            const int64_t den = denominator();
+            if(count_ < 2 || den <= 0) return Sensors::INVALID_READING_X10;
+
+            // slope per time unit = num / den  ->  per minute = num * 60000 / (den * 2^shift)
+            const int64_t num = static_cast<int64_t>(count_) * sumTX_ - static_cast<int64_t>(sumT_) * sumX_;
+            const int64_t scaledNum = num * 60000;
+            const int64_t scaledDen = den << Sampling::RATE_TIME_SHIFT;
+            const int64_t half = scaledDen / 2;
+            const int64_t rate = (scaledNum >= 0) ? (scaledNum + half) / scaledDen : (scaledNum - half) / scaledDen;
+
+            return (rate > INT16_MAX) ? INT16_MAX : (rate <= INT16_MIN) ? static_cast<int16_t>(INT16_MIN + 1) : static_cast<int16_t>(rate);
+        }
+
+        /// @brief Readings currently in the window
+        uint8_t size() const { return count_; }
+
+        /// @brief Window length in readings
+        uint8_t window() const { return window_; }
+
+        /// @brief Maximum window
+        static constexpr uint8_t capacity() { return Capacity; }
+
+    private:
+
+        /// @brief Ring slot of the i-th oldest reading
+        uint8_t slotOf(uint8_t i) const
+        {
+            uint8_t slot = head_ + i;
+            if(slot >= window_) slot -= window_;
+            return slot;
+        }
+
+        uint16_t oldestTime() const { return times_[head_]; }
+
+        /// @brief n * Stt - St^2 (n^2 * variance of the times, >= 0)
+        int64_t denominator() const
+        {
+            return static_cast<int64_t>(count_) * sumTT_ - static_cast<int64_t>(sumT_) * sumT_;
+        }
+
+        /// @brief Remove the oldest reading and move the time origin to the next one
+        void evictOldest()
+        {
+            // Step1: Remove it (its relative time is 0 -> only Sx changes)
+            const uint16_t oldest = oldestTime();
+            sumX_ -= values_[head_];
+            if(++head_ == window_) head_ = 0;
+            if(--count_ == 0) { clear(); return; }
+
+            // Step2: Shift the time origin by d (unsigned math: intermediate terms may wrap, the result fits)
+            const uint32_t d = static_cast<uint16_t>(oldestTime() - oldest);
+            const uint32_t n = count_;
+            sumTT_ = sumTT_ - 2 * d * sumT_ + n * d * d;
+            sumT_ -= n * d;
+            sumTX_ -= static_cast<int32_t>(d) * sumX_;
+        }
+
+        int16_t  values_[Capacity];     // Values relative to baseX_ (ring)
+        uint16_t times_[Capacity];      // Timestamps in 2^RATE_TIME_SHIFT ms units (ring, wraps)
+        uint32_t sumT_;                 // Sum of times relative to the oldest reading
+        uint32_t sumTT_;                // Sum of squared relative times
+        int32_t  sumX_;                 // Sum of relative values
+        int32_t  sumTX_;                // Sum of relative time * relative value
+        uint32_t lastMs_;               // millis() of the newest reading (staleness check)
+        int16_t  baseX_;                // Value origin (first reading after clear())
+
+        uint8_t  window_;               // Active window (<= Capacity)
+        uint8_t  head_;                 // Ring slot of the oldest reading
+        uint8_t  count_;                // Readings in the window
+};
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "config/Config.h"              // For Sensors::INVALID_READING_X10
+#include "Model/TemperatureResult.h"    // For ReadingStatus
+#include "Model/TemperatureUnit.h"      // For the integer unit conversions
+
+
+/**
+ * @brief Snapshot of one acquisition through the sensor pipeline
+ *
+ * @details
+ *  Every field comes from the same ADC sample, so logging several values (raw counts, resistance, unfiltered
+ *  and filtered temperature) never triggers another acquisition nor steps the filter again.
+ *  - Fields after the failing stage keep their defaults (0 / Sensors::INVALID_READING_X10).
+ *  - BelowTable / AboveTable readings carry the table edge temperature (see TemperatureResult).
+ *  - Unit accessors are pure arithmetic on temperature_x10: integer x10 ones (no float code pulled in),
+ *    float ones only when explicitly called.
+ *
+ * @example
+ *  const Reading r = sensor.read();
+ *  if(r.isValid()) LOGI("Fridge: %.1f °C (raw %u, %lu x0.1 Ohm)", r.celsius(), r.adc_raw, (unsigned long)r.resistance_x10);
+ */
+struct Reading
+{
+    uint16_t adc_raw = 0;                                           // Averaged ADC counts
+    uint32_t resistance_x10 = 0;                                    // NTC resistance (0.1Ω)
+    int16_t  unfiltered_x10 = Sensors::INVALID_READING_X10;         // Temperature before the filter (0.1°C)
+    int16_t  temperature_x10 = Sensors::INVALID_READING_X10;        // Filtered temperature (0.1°C)
+    ReadingStatus status = ReadingStatus::NotConfigured;            // Outcome of the acquisition
+    uint32_t timestamp_ms = 0;                                      // millis() when the ADC was sampled
+
+    /// @brief True for an in-range measurement
+    bool isValid() const noexcept { return status == ReadingStatus::Ok; }
+
+    /// @brief True when temperature_x10 sits on a table edge (BelowTable / AboveTable)
+    bool isClamped() const noexcept { return status == ReadingStatus::BelowTable || status == ReadingStatus::AboveTable; }
+
+    /// @brief True when temperature_x10 holds a temperature (in range or clamped)
+    bool hasValue() const noexcept { return isValid() || isClamped(); }
+
+    // --- Integer unit accessors (no resampling, Sensors::INVALID_READING_X10 without value) ---
+    int16_t fahrenheit_x10() const noexcept
+    {
+        return hasValue() ? celsiusToFahrenheit_x10(temperature_x10) : Sensors::INVALID_READING_X10;
+    }
+
+    int16_t kelvin_x10() const noexcept
+    {
+        return hasValue() ? celsiusToKelvin_x10(temperature_x10) : Sensors::INVALID_READING_X10;
+    }
+
+    int16_t temperature_x10_in(TemperatureUnit unit) const noexcept
+    {
+        return hasValue() ? convertTemperature_x10(temperature_x10, unit) : Sensors::INVALID_READING_X10;
+    }
+
+    // --- Float unit accessors (no resampling, -999.9 without value) ---
+    float celsius() const noexcept
+    {
+        return hasValue() ? static_cast<float>(temperature_x10) / 10.0f : -999.9f;
+    }
+
+    float fahrenheit() const noexcept
+    {
+        return hasValue() ? static_cast<float>(temperature_x10) * 0.18f + 32.0f : -999.9f;
+    }
+
+    float kelvin() const noexcept
+    {
+        return hasValue() ? static_cast<float>(temperature_x10) / 10.0f + 273.15f : -999.9f;
+    }
+};
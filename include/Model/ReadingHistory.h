@@ -0,0 +1,198 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "config/Config.h"
+#include "Model/Reading.h"
+#include "logger/Logger.h"
+
+
+namespace reading_history_detail
+{
+    /// @brief Smallest unsigned type able to index Capacity slots
+    template<bool Small> struct IndexType           { using type = uint16_t; };
+    template<>           struct IndexType<true>     { using type = uint8_t;  };
+}
+
+
+/**
+ * @brief Fixed-capacity history of temperature readings with O(1) rolling mean / min / max
+ *
+ * @details
+ *  - Statically allocated ring of the last window() values (window() <= Capacity, set at run time).
+ *  - Mean: running sum updated on every push (sum += new - evicted), rounded to nearest on query.
+ *  - Min / Max: one monotonic deque each, holding ring positions whose values are increasing (min) /
+ *    decreasing (max). The front is the answer; a push pops the dominated tail entries and the
+ *    front leaves when its ring slot is overwritten. Amortized O(1) per push, O(1) per query.
+ *  - No rescan ever: control / telemetry code can query every loop.
+ *  - RAM: Capacity * (2 + 2 * sizeof(index)) bytes (index is 1 byte up to 256 slots), e.g. 120 bytes for 30 slots.
+ *
+ * @example
+ *  static ReadingHistory<Sampling::HISTORY_CAPACITY> fridgeHistory;   // One per sensor
+ *  fridgeHistory.push(sensors.reading(FRIDGE));                       // Readings without value are skipped
+ *  if(fridgeHistory.max_x10() > 80) ...                               // Max over the window
+ *
+ * @tparam Capacity - Maximum window in samples (2..65535)
+ */
+template<uint16_t Capacity = Sampling::HISTORY_CAPACITY>
+class ReadingHistory
+{
+    static_assert(Capacity >= 2, "ReadingHistory: capacity must be >= 2");
+
+    using Index = typename reading_history_detail::IndexType<(Capacity <= 256)>::type;
+
+    public:
+
+        /// @brief Construct an empty history using the whole capacity as window
+        ReadingHistory():
+        ring_{},
+        minQueue_{},
+        maxQueue_{},
+        sum_(0),
+        window_(Capacity),
+        head_(0),
+        count_(0),
+        minFront_(0),
+        minSize_(0),
+        maxFront_(0),
+        maxSize_(0)
+        {};
+
+        /// @brief Change the window (clamped to 1..Capacity); clears the history
+        void setWindow(uint16_t window)
+        {
+            if(window == 0 || window > Capacity)
+            {
+                LOGW("ReadingHistory:: window %u out of 1..%u, clamping", window, Capacity);
+                window = (window == 0) ? 1 : Capacity;
+            }
+            window_ = window;
+            clear();
+        }
+
+        /// @brief Forget every sample
+        void clear()
+        {
+            sum_ = 0;
+            head_ = 0;
+            count_ = 0;
+            minFront_ = minSize_ = 0;
+            maxFront_ = maxSize_ = 0;
+        }
+
+        /**
+         * @brief Append a temperature, evicting the oldest one once the window is full
+         *
+         * @param value_x10 - Temperature in 0.1°C
+         */
+        void push(int16_t value_x10)
+        {
+            const Index slot = static_cast<Index>(head_);
+
+            // Step1: Evict the value about to be overwritten (sum + deque fronts)
+            if(count_ == window_)
+            {
+                sum_ -= ring_[slot];
+                if(minSize_ && minQueue_[minFront_] == slot) popFront(minFront_, minSize_);
+                if(maxSize_ && maxQueue_[maxFront_] == slot) popFront(maxFront_, maxSize_);
+            }
+            else
+            {
+                ++count_;
+            }
+
+            // Step2: Store the new value
+            ring_[slot] = value_x10;
+            sum_ += value_x10;
+            if(++head_ == window_) head_ = 0;
+
+            // Step3: Keep the deques monotonic (pop the tail values the new one dominates)
+            while(minSize_ && ring_[back(minFront_, minSize_, minQueue_)] >= value_x10) --minSize_;
+            pushBack(minQueue_, minFront_, minSize_, slot);
+
+            while(maxSize_ && ring_[back(maxFront_, maxSize_, maxQueue_)] <= value_x10) --maxSize_;
+            pushBack(maxQueue_, maxFront_, maxSize_, slot);
+        }
+
+        /**
+         * @brief Append the filtered temperature of a reading
+         *
+         * @return true if stored, false if the reading had no value (fault)
+         */
+        bool push(const Reading& reading)
+        {
+            if(!reading.hasValue()) return false;
+            push(reading.temperature_x10);
+            return true;
+        }
+
+        // --- O(1) queries (Sensors::INVALID_READING_X10 while empty) ---
+
+        /// @brief Rounded mean of the window in 0.1°C
+        int16_t mean_x10() const
+        {
+            if(count_ == 0) return Sensors::INVALID_READING_X10;
+            const int32_t half = count_ / 2;
+            return static_cast<int16_t>((sum_ >= 0) ? (sum_ + half) / count_ : (sum_ - half) / count_);
+        }
+
+        /// @brief Minimum of the window in 0.1°C
+        int16_t min_x10() const { return minSize_ ? ring_[minQueue_[minFront_]] : Sensors::INVALID_READING_X10; }
+
+        /// @brief Maximum of the window in 0.1°C
+        int16_t max_x10() const { return maxSize_ ? ring_[maxQueue_[maxFront_]] : Sensors::INVALID_READING_X10; }
+
+        /// @brief Most recent value in 0.1°C
+        int16_t latest_x10() const
+        {
+            if(count_ == 0) return Sensors::INVALID_READING_X10;
+            return ring_[(head_ == 0) ? (window_ - 1) : (head_ - 1)];
+        }
+
+        /// @brief Samples currently in the window
+        uint16_t size() const { return count_; }
+
+        /// @brief Window length in samples
+        uint16_t window() const { return window_; }
+
+        /// @brief True once window() samples were pushed
+        bool isFull() const { return count_ == window_; }
+
+        /// @brief Maximum window
+        static constexpr uint16_t capacity() { return Capacity; }
+
+    private:
+
+        /// @brief Deque helpers (circular buffers of Capacity positions)
+        static void popFront(uint16_t& front, uint16_t& size)
+        {
+            if(++front == Capacity) front = 0;
+            --size;
+        }
+
+        static Index back(uint16_t front, uint16_t size, const Index (&queue)[Capacity])
+        {
+            uint16_t i = front + size - 1;
+            if(i >= Capacity) i -= Capacity;
+            return queue[i];
+        }
+
+        static void pushBack(Index (&queue)[Capacity], uint16_t front, uint16_t& size, Index slot)
+        {
+            uint16_t i = front + size;
+            if(i >= Capacity) i -= Capacity;
+            queue[i] = slot;
+            ++size;
+        }
+
+        int16_t  ring_[Capacity];       // Last window_ values (ring)
+        Index    minQueue_[Capacity];   // Ring positions with increasing values (front = min)
+        Index    maxQueue_[Capacity];   // Ring positions with decreasing values (front = max)
+        int32_t  sum_;                  // Running sum of the window
+
+        uint16_t window_;               // Active window (<= Capacity)
+        uint16_t head_;                 // Next ring slot to write
+        uint16_t count_;                // Values in the window
+        uint16_t minFront_, minSize_;   // Min deque state
+        uint16_t maxFront_, maxSize_;   // Max deque state
+};
@@ -0,0 +1,188 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "config/Config.h"
+#include "Model/TemperatureSensor.h"
+#include "Model/Reading.h"
+#include "logger/Logger.h"
+
+
+/**
+ * @brief Owns N temperature sensor pipelines and samples each one on its own period
+ *
+ * @details
+ *  - The TemperatureSensor objects live inside the array (static storage when the array is static), configured
+ *    through sensor(i) with the usual fluent API.
+ *  - Every channel has a sample period (ms) and a deadline. update() is called from loop() as often as possible:
+ *      1. Advances the acquisition in flight (split-phase: requestReading()/poll(), never blocks on the ADC).
+ *      2. When the ADC is free, starts the due channel with the earliest deadline (deadline order, so a fast
+ *         channel never starves a slow one that is already late).
+ *  - One acquisition in flight at a time: the channels share the single ADC.
+ *  - Deadlines advance by whole periods (no drift). A channel that fell more than one period behind is
+ *    rescheduled from now instead of bursting to catch up.
+ *  - Period 0 disables a channel; setPeriod() can change it at run time (e.g. a shorter period while a
+ *    probe goes through a fast transient).
+ *  - A channel whose request fails (pipeline not configured) is still reported by update(), with its
+ *    NotConfigured result.
+ *  - An acquisition cancelled through sensor(i) (cancelReading(), addSampler() with another sampler) is
+ *    dropped without a result; the scheduler moves on to the next due channel.
+ *  - Out-of-range channel indexes are logged and ignored: setPeriod() does nothing, sensor()/reading() give a
+ *    detached pipeline that is never scheduled (configuring it touches no probe).
+ *
+ * @example
+ *  static SensorArray<2> sensors;
+ *  sensors.sensor(0).addSampler(&sampler0).addResistanceConverter(&divider).addTemperatureConverter(&lut).build();
+ *  sensors.setPeriod(0, 2000);
+ *  sensors.begin();
+ *
+ *  void loop() {
+ *      uint8_t ch;
+ *      if(sensors.update(ch) && sensors.reading(ch).isValid()) LOGI("ch%u: %.1f °C", ch, sensors.reading(ch).celsius());
+ *  }
+ *
+ * @tparam N - Number of channels (1..Sampling::MAX_CHANNELS)
+ */
+template<uint8_t N>
+class SensorArray
+{
+    static_assert(N > 0 && N <= Sampling::MAX_CHANNELS, "SensorArray: 1..Sampling::MAX_CHANNELS channels");
+
+    public:
+
+        /// @brief Construct an array with every channel disabled (period 0)
+        SensorArray():
+        sensors_(),
+        period_ms_{},
+        deadline_ms_{},
+        active_(NO_CHANNEL),
+        failed_(NO_CHANNEL),
+        initialize_(false)
+        {};
+
+        /// @brief Final initialization: every enabled channel becomes due right away
+        void begin()
+        {
+            if(initialize_) return;
+
+            const uint32_t now = millis();
+            for(uint8_t i = 0; i < N; ++i)
+            {
+                deadline_ms_[i] = now;
+                if(period_ms_[i] == 0) LOGW_SENSOR("SensorArray:: channel %d disabled (period 0)", i);
+            }
+
+            initialize_ = true;
+        };
+
+        /// @brief Pipeline of channel i (configure it with the TemperatureSensor fluent API)
+        TemperatureSensor& sensor(uint8_t i) { return valid(i) ? sensors_[i] : detached(); }
+
+        /// @brief Set the sample period of channel i (0 -> disabled), the next deadline keeps its phase
+        SensorArray& setPeriod(uint8_t i, uint32_t period_ms)
+        {
+            if(!valid(i)) return *this;
+            if(period_ms_[i] == 0) deadline_ms_[i] = millis();     // Enabling: due right away
+            period_ms_[i] = period_ms;
+            return *this;
+        }
+
+        /// @brief Sample period of channel i in ms (0 -> disabled or invalid channel)
+        uint32_t period(uint8_t i) const { return valid(i) ? period_ms_[i] : 0; }
+
+        /// @brief Latest completed snapshot of channel i (status NotConfigured until the first one)
+        const Reading& reading(uint8_t i) const { return valid(i) ? sensors_[i].result() : detached().result(); }
+
+        /// @brief Number of channels
+        static constexpr uint8_t size() { return N; }
+
+        /**
+         * @brief Scheduler step: advance the acquisition in flight, start the next due one
+         *
+         * @param channel - Receives the channel whose reading() completed (only when true is returned)
+         * @return true  - reading(channel) holds a new result (one channel per call)
+         * @return false - Nothing completed during this call
+         */
+        bool update(uint8_t& channel)
+        {
+            // Step0: A request that failed during the previous call is reported now (result() is NotConfigured)
+            if(failed_ != NO_CHANNEL)
+            {
+                channel = failed_;
+                failed_ = NO_CHANNEL;
+                return true;
+            }
+
+            uint8_t completed = NO_CHANNEL;
+
+            // Step1: Advance the acquisition in flight (cancelled through sensor(i): nothing to report, ADC free)
+            if(active_ != NO_CHANNEL)
+            {
+                if(sensors_[active_].isPending())
+                {
+                    if(!sensors_[active_].poll()) return false;     // Still sampling: the ADC is busy
+                    completed = active_;
+                }
+                active_ = NO_CHANNEL;
+            }
+
+            // Step2: Start the due channel with the earliest deadline
+            const uint32_t now = millis();
+            uint8_t next = NO_CHANNEL;
+            int32_t mostLate = -1;
+            for(uint8_t i = 0; i < N; ++i)
+            {
+                if(period_ms_[i] == 0) continue;
+
+                const int32_t late = static_cast<int32_t>(now - deadline_ms_[i]);   // Wrap-safe
+                if(late > mostLate)
+                {
+                    mostLate = late;
+                    next = i;
+                }
+            }
+
+            if(next != NO_CHANNEL)
+            {
+                // Step3: Next deadline one period later (from now if it fell more than a period behind)
+                deadline_ms_[next] += period_ms_[next];
+                if(static_cast<int32_t>(now - deadline_ms_[next]) >= 0) deadline_ms_[next] = now + period_ms_[next];
+
+                // Step4: A failed request completes at once with its NotConfigured result (now, or on the next call)
+                if(sensors_[next].requestReading()) active_ = next;
+                else if(completed == NO_CHANNEL)    completed = next;
+                else                                failed_ = next;
+            }
+
+            if(completed == NO_CHANNEL) return false;
+            channel = completed;
+            return true;
+        }
+
+    private:
+
+        static constexpr uint8_t NO_CHANNEL = 0xFF;     // No channel (active_/failed_)
+
+        /// @brief True for a channel index in range (out of range is logged)
+        static bool valid(uint8_t i)
+        {
+            if(i < N) return true;
+            LOGE_SENSOR("SensorArray:: invalid channel %u", i);
+            return false;
+        }
+
+        /// @brief Pipeline handed out for invalid channels: never scheduled, never configured by the array
+        static TemperatureSensor& detached()
+        {
+            static TemperatureSensor unused;
+            return unused;
+        }
+
+        TemperatureSensor sensors_[N];      // Channel pipelines
+        uint32_t period_ms_[N];             // Sample period per channel (0 -> disabled)
+        uint32_t deadline_ms_[N];           // millis() when each channel is next due
+        uint8_t active_;                    // Channel with an acquisition in flight (NO_CHANNEL -> ADC free)
+        uint8_t failed_;                    // Channel whose request failed, reported by the next update()
+
+        bool initialize_;                   // To avoid reinitialization
+};
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "config/Config.h"      // For Adc:: fault thresholds, Sensors::INVALID_READING_X10
+
+
+/**
+ * @brief Outcome of an acquisition / conversion
+ *
+ * @details
+ *  - OpenCircuit / ShortCircuit are detected on the raw ADC counts, before any division or table search.
+ *  - BelowTable / AboveTable: the resistance is outside the LUT, the value is clamped to the table edge
+ *    (-40.0 °C / +40.0 °C): usable as a bound, not as a measurement.
+ */
+enum class ReadingStatus : uint8_t
+{
+    Ok,                     // Every stage produced a valid value
+    NotConfigured,          // Sampler/converters missing or sampler not running (Adc::INVALID_SAMPLE): nothing was acquired
+    OpenCircuit,            // Junction at V_REF: NTC disconnected (adc_raw >= Adc::OPEN_CIRCUIT_MIN_COUNTS)
+    ShortCircuit,           // Junction at GND: NTC shorted (adc_raw <= Adc::SHORT_CIRCUIT_MAX_COUNTS)
+    BelowTable,             // Colder than the LUT: value clamped to the first entry
+    AboveTable,             // Hotter than the LUT: value clamped to the last entry
+    ConversionError         // A conversion stage failed (invalid resistance / temperature)
+};
+
+
+/**
+ * @brief Compact temperature result: value + status (3 bytes, returned in registers)
+ */
+struct TemperatureResult
+{
+    int16_t value_x10 = Sensors::INVALID_READING_X10;   // Temperature (0.1°C), meaningful when hasValue()
+    ReadingStatus status = ReadingStatus::ConversionError;
+
+    /// @brief True for an in-range measurement
+    bool isValid() const noexcept { return status == ReadingStatus::Ok; }
+
+    /// @brief True when the value sits on a table edge (BelowTable / AboveTable)
+    bool isClamped() const noexcept { return status == ReadingStatus::BelowTable || status == ReadingStatus::AboveTable; }
+
+    /// @brief True when value_x10 holds a temperature (in range or clamped)
+    bool hasValue() const noexcept { return isValid() || isClamped(); }
+};
+
+
+/**
+ * @brief Classify a raw ADC reading before converting it (no division, two compares)
+ *
+ * @param adc_raw - Averaged ADC counts at the divider junction
+ * @return ReadingStatus - NotConfigured (Adc::INVALID_SAMPLE), OpenCircuit, ShortCircuit or Ok (worth converting)
+ */
+constexpr ReadingStatus classifyAdc(uint16_t adc_raw) noexcept
+{
+    return (adc_raw == Adc::INVALID_SAMPLE)           ? ReadingStatus::NotConfigured :
+           (adc_raw >= Adc::OPEN_CIRCUIT_MIN_COUNTS)  ? ReadingStatus::OpenCircuit  :
+           (adc_raw <= Adc::SHORT_CIRCUIT_MAX_COUNTS) ? ReadingStatus::ShortCircuit :
+           ReadingStatus::Ok;
+}
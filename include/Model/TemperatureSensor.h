@@ -6,18 +6,15 @@
 #include "interfaces/IResistanceConverter.h"    // For Voltage divider ADC-> Resistance
 #include "interfaces/ITemperatureConverter.h"   // For ITemperatureConverter interface Resistance->Temperature
 #include "interfaces/IFilter.h"                 // For IFilter interface -> To filter temperature readings
+#include "Model/Reading.h"                      // For the single acquisition snapshot
+#include "Model/TemperatureUnit.h"              // For TemperatureUnit and the integer unit conversions
+#include "config/Config.h"                      // For the notification defaults
 #include "logger/Logger.h"                      // For logging
 
 /**
- * @brief Enum class to represent temperature units
- * 
+ * @brief Change notification callback: reading that triggered it + user context given to onChange()
  */
-enum class TemperatureUnit : uint8_t
-{
-    Celsius,
-    Fahrenheit,
-    Kelvin
-};
+using ReadingCallback = void (*)(const Reading& reading, void* context);
 
 /**
  * @brief High-level NTC temperature sensor composer with fluent configuration API
@@ -37,6 +34,21 @@ enum class TemperatureUnit : uint8_t
  *       .build();
  * 
  * int16_t temperature = sensor.readTemperature_x10();   
+ * int16_t fahrenheit = sensor.readTemperature_x10(TemperatureUnit::Fahrenheit);   // Integer conversion, no float
+ * 
+ * // Several values from one acquisition (the filter steps once):
+ * const Reading r = sensor.read();
+ * if(r.isValid()) LOGI("%.1f °C, raw %u", r.celsius(), r.adc_raw);
+ * 
+ * // Split-phase (non-blocking): start, do other work, convert + filter once the samples are ready
+ * sensor.requestReading();
+ * ...
+ * if(sensor.poll()) use(sensor.result());
+ * sensor.cancelReading();     // Giving up on a request: releases the ADC for the other sensors
+ * 
+ * // Event driven: called only when the filtered value moves more than the deadband (or status changes),
+ * // or after max_silence_ms without notification
+ * sensor.onChange(&logReading, context, Sampling::NOTIFY_DEADBAND_X10, Sampling::NOTIFY_MAX_SILENCE_MS);
  */
 class TemperatureSensor
 {
@@ -54,22 +66,63 @@ class TemperatureSensor
         TemperatureSensor& addTemperatureConverter(ITemperatureConverter* converter);
         TemperatureSensor& addFilter(IFilter<int16_t>* filter);
         TemperatureSensor& setUnits(TemperatureUnit unit);
+        TemperatureSensor& onChange(ReadingCallback callback, void* context = nullptr,
+                                    int16_t deadband_x10 = Sampling::NOTIFY_DEADBAND_X10,
+                                    uint32_t max_silence_ms = Sampling::NOTIFY_MAX_SILENCE_MS);
         TemperatureSensor& build();
 
-        // Method to read the temperature in tenths of degrees
+        // Single acquisition through the whole pipeline (raw, resistance, unfiltered/filtered temperature, status),
+        // fires the onChange() notification like poll()
+        Reading read() noexcept;
+
+        // Method to read the temperature in tenths of degrees (Celsius, or the given unit: integer math only)
         int16_t readTemperature_x10() const noexcept;
+        int16_t readTemperature_x10(TemperatureUnit unit) const noexcept;
+
+        // --- Split-phase (non-blocking) acquisition ---
+        bool requestReading() noexcept;                     // Start an acquisition, returns immediately
+        bool poll() noexcept;                               // Advance it, true once the new result() is ready
+        void cancelReading() noexcept;                      // Drop the pending acquisition (releases the ADC)
+        bool isPending() const noexcept { return pending_; }
+        const Reading& result() const noexcept { return result_; }   // Last completed acquisition
 
-        // --- Helper methods to read temperature in different units ---
+        // True once the filter (if any) finished its warm-up after boot/reset
+        bool isSettled() const noexcept;
+
+        // --- Helper methods to read temperature in different units (float: only when explicitly asked for) ---
+        // One-off reads: no onChange() notification (deadband/heartbeat state untouched)
         float readTemperature() const noexcept;
-        float readTemperatureC()  noexcept;
-        float readTemperatureF()  noexcept;
-        float readTemperatureK()  noexcept;
+        float readTemperatureC() const noexcept;
+        float readTemperatureF() const noexcept;
+        float readTemperatureK() const noexcept;
 
     private:     
+
+        // Steps 1..5 of the pipeline without notification (read() and the one-off helpers)
+        Reading acquire() const noexcept;
+
+        // Steps 2..5 of the pipeline on a sampled reading (fault classification, resistance, temperature, filter)
+        void convert(Reading& reading) const noexcept;
+
+        // Fire the onChange() callback if the reading left the deadband, changed status or the silence expired
+        void notify(const Reading& reading) noexcept;
         
         ISampler* sampler_ ;                                // Pointer to a Sampler object that knows how to sample ADC values
         IResistanceConverter* resistanceConverter_ ;        // Pointer to a ResistanceConverter object that converts ADC values to resistance
         ITemperatureConverter* temperatureConverter_ ;      // Pointer to a TemperatureConverter object that converts resistance to temperature
         IFilter<int16_t>* filter_ ;                         // Pointer to a Filter<T> that apply(EMA,SMA) filter the read temperature values 
         TemperatureUnit unit_;                              // Desired output temperature unit 
+
+        Reading result_;                                    // Split-phase: last completed acquisition
+        uint32_t requestedAtMs_;                            // Split-phase: millis() of the pending request
+        bool pending_;                                      // Split-phase: acquisition started, not yet converted
+
+        ReadingCallback callback_;                          // Change notification (nullptr -> disabled)
+        void* callbackContext_;                             // Passed back to callback_
+        int16_t deadbandX10_;                               // Minimum move of the filtered value to notify (0.1°C)
+        uint32_t maxSilenceMs_;                             // Notify at least this often (0 -> only on change)
+        int16_t notifiedX10_;                               // Value of the last notification
+        ReadingStatus notifiedStatus_;                      // Status of the last notification
+        uint32_t notifiedAtMs_;                             // millis() of the last notification
+        bool notified_;                                     // At least one notification since onChange()
 };
\ No newline at end of file
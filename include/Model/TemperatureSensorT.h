@@ -0,0 +1,169 @@
+#pragma once
+
+#include <stdint.h>                             // For standard integer types
+
+#include "Model/TemperatureUnit.h"              // For TemperatureUnit and the integer unit conversions
+#include "Model/Reading.h"                      // For the single acquisition snapshot
+#include "config/Config.h"                      // For Sensors::INVALID_READING_X10
+#include "Filter/filter_utils.h"                // For filter_utils::applyAt (timestamp to time-aware filters)
+#include "logger/Logger.h"                      // For logging
+
+
+/**
+ * @brief Filter stage that does nothing (TemperatureSensorT default: no filtering, no code)
+ */
+struct NoFilter
+{
+    void begin() {};
+    inline int16_t apply(int16_t new_value) { return new_value; }
+    inline void reset() {};
+    inline bool isSettled() const { return true; }
+
+    /// @brief Shared instance (stateless) for sensors built without a filter
+    static NoFilter& instance()
+    {
+        static NoFilter noFilter;
+        return noFilter;
+    }
+};
+
+
+/**
+ * @brief Compile-time composed NTC temperature sensor (zero virtual dispatch)
+ *
+ * @details
+ *  Same pipeline as TemperatureSensor:
+ *      Sampler-> ResistanceConverter->TemperatureConverter->(optional)Filter
+ *  but every stage is a template parameter instead of an interface pointer:
+ *  - Stages are called through their concrete type with a qualified call (sampler_.Sampler::sample()),
+ *    which is a direct call even when the stage also implements ISampler/IFilter, so the same objects
+ *    can still be plugged into the fluent TemperatureSensor.
+ *  - No null checks: the references are bound at construction.
+ *  - Header-only stages (FixedPullupResistanceConverter, fixed-point filters, FilterChain) inline completely,
+ *    so the pullup, alpha/shift and window constants fold into the code. Stages implemented in src/ are inlined
+ *    by the link-time optimizer (-flto, enabled by the Arduino AVR core).
+ *  - Stages must be concrete types (calling a pure virtual through a qualified name does not link).
+ *  - The fluent, interface-based TemperatureSensor stays available for run-time composition.
+ *
+ * @example
+ *  static AdcSampler sampler(Pins::COMPARTMENT_NTC_ADC_PIN, ...);
+ *  static FixedPullupResistanceConverter<Sensors::PULLUP_FIXED_RESISTOR_OHMS> divider;
+ *  static LutTemperatureConverter lut;
+ *  static ShiftEmaFilter<int16_t> filter;
+ *  static TemperatureSensorT sensor(sampler, divider, lut, filter);   // Types deduced (C++17)
+ *  static TemperatureSensorT raw(sampler, divider, lut);              // No filter
+ *
+ *  int16_t temperature = sensor.readTemperature_x10();
+ *
+ * @tparam Sampler              - Concrete sampler: uint16_t sample()
+ * @tparam ResistanceConverter  - Concrete converter: uint32_t convertToResistance_x10(uint16_t)
+ * @tparam TemperatureConverter - Concrete converter: TemperatureResult convertToTemperature(uint32_t)
+ * @tparam Filter               - Concrete filter: int16_t apply(int16_t), bool isSettled() (NoFilter -> none)
+ */
+template<typename Sampler, typename ResistanceConverter, typename TemperatureConverter, typename Filter = NoFilter>
+class TemperatureSensorT
+{
+    public:
+
+        /// @brief Compose a sensor with a filter
+        TemperatureSensorT(Sampler& sampler, ResistanceConverter& resistanceConverter,
+                           TemperatureConverter& temperatureConverter, Filter& filter):
+        sampler_(sampler),
+        resistanceConverter_(resistanceConverter),
+        temperatureConverter_(temperatureConverter),
+        filter_(filter)
+        {};
+
+        /// @brief Compose a sensor without filter (Filter = NoFilter)
+        TemperatureSensorT(Sampler& sampler, ResistanceConverter& resistanceConverter,
+                           TemperatureConverter& temperatureConverter):
+        TemperatureSensorT(sampler, resistanceConverter, temperatureConverter, NoFilter::instance())
+        {};
+
+        /**
+         * @brief Read temperature as fixed point in tenths of degrees (0.1°C resolution)
+         *
+         * @return int16_t - Temperature in tenths of degrees (e.g., 250 = 25.0 °C), Sensors::INVALID_READING_X10 on error
+         */
+        int16_t readTemperature_x10() noexcept
+        {
+            return read().temperature_x10;  // INVALID_READING_X10 unless the reading has a value (Ok or clamped)
+        }
+
+        /**
+         * @brief Run one acquisition and keep every intermediate value (see TemperatureSensor::read())
+         *
+         * @return Reading - Snapshot of the acquisition (status tells which stage failed, if any)
+         */
+        Reading read() noexcept
+        {
+            Reading reading;
+
+            reading.timestamp_ms = millis();
+            reading.adc_raw = sampler_.Sampler::sample();
+
+            // Step1: Open/short NTC never reach a division or the LUT
+            reading.status = classifyAdc(reading.adc_raw);
+            if(reading.status != ReadingStatus::Ok)
+            {
+                LOGW_SENSOR("TemperatureSensorT::read: No usable sample, status %d (ADC raw %u)", static_cast<int>(reading.status), reading.adc_raw);
+                return reading;
+            }
+
+            // Step2: ADC raw -> Resistance (0.1Ω resolution)
+            reading.resistance_x10 = resistanceConverter_.ResistanceConverter::convertToResistance_x10(reading.adc_raw);
+            if(reading.resistance_x10 == 0)
+            {
+                LOGE_SENSOR("TemperatureSensorT::read: Invalid resistance value 0 (ADC raw %u)", reading.adc_raw);
+                reading.status = ReadingStatus::ConversionError;
+                return reading;
+            }
+
+            // Step3: Resistance -> Temperature (0.1°C resolution, clamped readings keep their value)
+            const TemperatureResult temperature = temperatureConverter_.TemperatureConverter::convertToTemperature(reading.resistance_x10);
+            reading.status = temperature.status;
+            if(!temperature.hasValue())
+            {
+                LOGE_SENSOR("TemperatureSensorT::read: Invalid temperature value from converter, status %d", static_cast<int>(temperature.status));
+                return reading;
+            }
+
+            // Step4: Apply filter (NoFilter compiles to nothing), time-aware filters get the timestamp
+            reading.unfiltered_x10 = temperature.value_x10;
+            reading.temperature_x10 = filter_utils::applyAt(filter_, reading.unfiltered_x10, reading.timestamp_ms);
+            return reading;
+        }
+
+        /// @brief True once the filter finished its warm-up after boot/reset
+        bool isSettled() const noexcept { return filter_.Filter::isSettled(); }
+
+        // --- Helper methods to read temperature in different units ---
+
+        /// @brief Read temperature in tenths of the given unit (integer math only, Sensors::INVALID_READING_X10 on error)
+        int16_t readTemperature_x10(TemperatureUnit unit) noexcept { return read().temperature_x10_in(unit); }
+
+        /// @brief Read temperature as a float in the given unit (-999.9 on error)
+        float readTemperature(TemperatureUnit unit = TemperatureUnit::Celsius) noexcept
+        {
+            const int16_t temp_x10 = readTemperature_x10(unit);
+            if(temp_x10 == Sensors::INVALID_READING_X10) return -999.9f;   // Sentinel invalid value
+
+            return static_cast<float>(temp_x10) / 10.0f;
+        }
+
+        float readTemperatureC() noexcept { return readTemperature(TemperatureUnit::Celsius); }
+        float readTemperatureF() noexcept { return readTemperature(TemperatureUnit::Fahrenheit); }
+        float readTemperatureK() noexcept { return readTemperature(TemperatureUnit::Kelvin); }
+
+    private:
+
+        Sampler& sampler_;                              // Samples ADC values
+        ResistanceConverter& resistanceConverter_;      // ADC values -> resistance
+        TemperatureConverter& temperatureConverter_;    // Resistance -> temperature
+        Filter& filter_;                                // Filters the temperature readings (NoFilter -> none)
+};
+
+/// @brief Deduction guide: 3 stages -> no filter
+template<typename Sampler, typename ResistanceConverter, typename TemperatureConverter>
+TemperatureSensorT(Sampler&, ResistanceConverter&, TemperatureConverter&)
+    -> TemperatureSensorT<Sampler, ResistanceConverter, TemperatureConverter, NoFilter>;
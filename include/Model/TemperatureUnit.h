@@ -0,0 +1,90 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "config/Config.h"      // For Sensors::INVALID_READING_X10
+
+
+/**
+ * @brief Enum class to represent temperature units
+ *
+ */
+enum class TemperatureUnit : uint8_t
+{
+    Celsius,
+    Fahrenheit,
+    Kelvin
+};
+
+
+/**
+ * @brief Integer unit conversions in 0.1 degree fixed point (no float, no division)
+ *
+ * @details
+ *  - Fahrenheit: F = C * 1.8 + 32   ->  (C_x10 * 117965 + 2^15) >> 16  + 320   (1.8 in Q16)
+ *    C_x10 * 1.8 always ends in .0/.2/.4/.6/.8 and the Q16 error stays below 0.06 over the input range,
+ *    so the result is the exactly rounded value.
+ *  - Kelvin: K = C + 273.15          ->  C_x10 + 2732   (273.15 rounded half up)
+ *  - Sensors::INVALID_READING_X10 passes through; results beyond int16_t saturate (-3276.7 .. 3276.7).
+ */
+namespace temperature_unit
+{
+    constexpr int32_t FAHRENHEIT_SCALE_Q16  = 117965;   // round(1.8 * 2^16)
+    constexpr int16_t FAHRENHEIT_OFFSET_X10 = 320;      // 32.0 °F
+    constexpr int16_t KELVIN_OFFSET_X10     = 2732;     // 273.15 K
+    constexpr int16_t FAHRENHEIT_MAX_INPUT_X10 = 18026; // Above -> F_x10 > INT16_MAX
+    constexpr int16_t FAHRENHEIT_MIN_INPUT_X10 = -18204;// Below -> Q16 product beyond 32 bits (far below 0 K anyway: saturates)
+
+    /// @brief Saturate to int16_t without ever producing the error sentinel
+    constexpr int16_t saturate(int32_t value_x10)
+    {
+        return (value_x10 > INT16_MAX)  ? INT16_MAX :
+               (value_x10 < -INT16_MAX) ? static_cast<int16_t>(-INT16_MAX) :
+               static_cast<int16_t>(value_x10);
+    }
+}
+
+/**
+ * @brief Convert x10 °C to x10 °F
+ *
+ * @param celsius_x10 - Temperature in 0.1°C (Sensors::INVALID_READING_X10 on error)
+ * @return int16_t - Temperature in 0.1°F (Sensors::INVALID_READING_X10 on error)
+ */
+constexpr int16_t celsiusToFahrenheit_x10(int16_t celsius_x10) noexcept
+{
+    using namespace temperature_unit;
+    return (celsius_x10 == Sensors::INVALID_READING_X10) ? Sensors::INVALID_READING_X10 :
+           (celsius_x10 > FAHRENHEIT_MAX_INPUT_X10)      ? static_cast<int16_t>(INT16_MAX) :
+           (celsius_x10 < FAHRENHEIT_MIN_INPUT_X10)      ? static_cast<int16_t>(-INT16_MAX) :
+           saturate(((static_cast<int32_t>(celsius_x10) * FAHRENHEIT_SCALE_Q16 + 32768) >> 16) + FAHRENHEIT_OFFSET_X10);
+}
+
+/**
+ * @brief Convert x10 °C to x10 K
+ *
+ * @param celsius_x10 - Temperature in 0.1°C (Sensors::INVALID_READING_X10 on error)
+ * @return int16_t - Temperature in 0.1K (Sensors::INVALID_READING_X10 on error)
+ */
+constexpr int16_t celsiusToKelvin_x10(int16_t celsius_x10) noexcept
+{
+    return (celsius_x10 == Sensors::INVALID_READING_X10) ? Sensors::INVALID_READING_X10 :
+           temperature_unit::saturate(static_cast<int32_t>(celsius_x10) + temperature_unit::KELVIN_OFFSET_X10);
+}
+
+/**
+ * @brief Convert x10 °C to x10 of the given unit
+ *
+ * @param celsius_x10 - Temperature in 0.1°C (Sensors::INVALID_READING_X10 on error)
+ * @param unit - Target unit
+ * @return int16_t - Temperature in 0.1 of the unit (Sensors::INVALID_READING_X10 on error)
+ */
+constexpr int16_t convertTemperature_x10(int16_t celsius_x10, TemperatureUnit unit) noexcept
+{
+    return (unit == TemperatureUnit::Fahrenheit) ? celsiusToFahrenheit_x10(celsius_x10) :
+           (unit == TemperatureUnit::Kelvin)     ? celsiusToKelvin_x10(celsius_x10) :
+           celsius_x10;
+}
+
+static_assert(celsiusToFahrenheit_x10(0) == 320 && celsiusToFahrenheit_x10(1000) == 2120 && celsiusToFahrenheit_x10(-400) == -400,
+              "celsiusToFahrenheit_x10: fixed-point scale");
+static_assert(celsiusToKelvin_x10(0) == 2732 && celsiusToKelvin_x10(-2732) == 0, "celsiusToKelvin_x10: offset");
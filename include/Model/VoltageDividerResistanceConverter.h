@@ -6,6 +6,8 @@
 #include "logger/Logger.h"                      // For debugging
 #include "config/Config.h"                      // Centralize configuration params
 
+class DualPullupAdcSampler;                     // Range source for the auto-ranging divider
+
 
 /**
  * @brief Converts ADC raw readings values to Thermistor resistance values using the voltage divider formula
@@ -16,6 +18,9 @@
  *          V_junction(raw Adc) = V_REF * (adc_raw/1023);
  *      - This class use counts for efficiency and scaled by 10 for precision:
  *          R_NTC = (adc_raw * pullup_Ohms * 10)/(1023 - adc_raw);  
+ *  * Auto-ranging divider (see DualPullupAdcSampler): the effective pullup follows the range used by the sampler
+ *      - High range: pullup_Ohms
+ *      - Low range:  pullup_Ohms || switched_pullup_Ohms
  * 
  * @example
  *  // Example:
@@ -28,7 +33,13 @@ class VoltageDividerResistanceConverter : public IResistanceConverter
 
         /// @brief Constructor for the Voltage Divider sensing circuit conversion from ADC raw to Resistance
         /// @param pullup_Ohms - Fixed resistance connected to V_REF
-        VoltageDividerResistanceConverter(uint16_t pullup_Ohms = Sensors::PULLUP_FIXED_RESISTOR_OHMS);
+        VoltageDividerResistanceConverter(uint32_t pullup_Ohms = Sensors::PULLUP_FIXED_RESISTOR_OHMS);
+
+        /// @brief Constructor for the auto-ranging (dual pullup) divider
+        /// @param pullup_Ohms - Fixed resistance permanently connected to V_REF
+        /// @param switched_pullup_Ohms - Resistance driven by the range GPIO (in parallel on the Low range)
+        /// @param rangeSource - Sampler that reports the range used for each sample
+        VoltageDividerResistanceConverter(uint32_t pullup_Ohms, uint32_t switched_pullup_Ohms, const DualPullupAdcSampler* rangeSource);
 
         /// @brief Final Initialization: fixed resistor validation
         void begin();
@@ -42,7 +53,12 @@ class VoltageDividerResistanceConverter : public IResistanceConverter
 
     private:
 
-        const uint16_t fixedResistor_;  // Pullup Fixed resistor in series with the NTC for the Voltage Divider sensing circuit 
+        /// @brief Pullup to apply for the current sample (fixed one unless the range source selected the Low range)
+        uint32_t effectivePullup() const noexcept;
+
+        const uint32_t fixedResistor_;  // Pullup Fixed resistor in series with the NTC for the Voltage Divider sensing circuit 
+        const uint32_t lowRangeResistor_;               // fixed || switched pullup (0 when not auto-ranging)
+        const DualPullupAdcSampler* const rangeSource_; // Range source (nullptr for the single pullup circuit)
 
         bool initialize_;               // To avoid reinitialization on a VoltageDividerResistance instance is already initialize
 };
\ No newline at end of file
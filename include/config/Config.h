@@ -1,7 +1,17 @@
 #pragma once
 
 #include <stdint.h>
-#include <Arduino.h>
+
+#if defined(ARDUINO)
+    #include <Arduino.h>
+#else
+/// @brief Host builds (offline tools/trace processing): the Nano analog pin numbers Arduino.h would provide
+namespace HostPins
+{
+    constexpr uint8_t A0 = 14;
+    constexpr uint8_t A1 = 15;
+}
+#endif
 
 // =================================================================
 //                  Hardware Sensor Configuration
@@ -10,8 +20,13 @@
 
 namespace Pins
 {
+#if !defined(ARDUINO)
+    using HostPins::A0;
+    using HostPins::A1;
+#endif
     constexpr uint8_t EVAPORATOR_NTC_ADC_PIN  = A0; // Analog pin for the evaporator temperature sensor.
     constexpr uint8_t COMPARTMENT_NTC_ADC_PIN = A1; // Analog pin for the fridge compartment temperature sensor.
+    constexpr uint8_t EVAPORATOR_PULLUP_SWITCH_PIN = 2; // GPIO that drives the switched pullup (auto-ranging divider only).
 }
 
 namespace Adc
@@ -22,6 +37,27 @@ namespace Adc
     constexpr uint8_t  SAMPLES_TO_AVERAGE = 16;                 // Number of ADC samples to average per reading (power of 2 for fast division)
     constexpr uint8_t  SAMPLES_TO_DISCARD = 4;                  // Number of initial samples to discard for signal settling
     constexpr uint8_t  SETTLE_TIME_US = 50;                     // Microseconds
+
+    // Auto-ranging divider: junction window in counts. Outside of it the sampler swaps pullups (hysteresis is implicit
+    // because both thresholds map to different resistances on each range)
+    constexpr uint16_t RANGE_SWITCH_LOW_COUNTS  = 256;          // Below 1/4 scale -> NTC too small for the high-range pullup
+    constexpr uint16_t RANGE_SWITCH_HIGH_COUNTS = 768;          // Above 3/4 scale -> NTC too big for the low-range pullup
+
+    // Fault detection on raw counts (5V -> pullup -> junction -> NTC -> GND), checked before any division.
+    // The LUT spans ~300 counts (+40°C, 5.3K) to ~992 counts (-40°C, 402K) with the 12.7K pullup, and stays
+    // inside the window on both ranges of the auto-ranging divider.
+    constexpr uint16_t SHORT_CIRCUIT_MAX_COUNTS = 3;               // adc <= 3    -> NTC below ~40Ω (shorted)
+    constexpr uint16_t OPEN_CIRCUIT_MIN_COUNTS  = MAX_VALUE - 3;   // adc >= 1020 -> NTC above ~4.3MΩ (open), also avoids the /0 at 1023
+    constexpr uint16_t INVALID_SAMPLE = 0xFFFF;                    // Sampler could not acquire (not running / nothing wrapped): never a count
+
+    // INL/DNL correction curve: one knot every 2^CORRECTION_KNOT_SHIFT counts (see data/adc_correction.h)
+    constexpr uint8_t  CORRECTION_KNOT_SHIFT = 6;                                           // 64 counts between knots
+    constexpr uint8_t  CORRECTION_KNOTS = ((MAX_VALUE + 1) >> CORRECTION_KNOT_SHIFT) + 1;   // 17 knots: 0, 64, ... 1024
+
+    // Free-running ADC + CIC decimator (CicAdcSampler): 16 MHz / 128 / 13 ~= 9.6 kHz in, / 64 -> ~150 Hz out
+    constexpr uint8_t  CIC_ORDER = 3;                           // Integrator/comb stages (attenuation of aliases)
+    constexpr uint16_t CIC_DECIMATION = 64;                     // Input samples per output sample (power of 2 -> shift)
+    constexpr uint16_t CIC_PRIME_TIMEOUT_MS = 100;              // sample() gives up waiting for the first output (~27 ms normally)
 }
 
 namespace Sensors
@@ -29,16 +65,76 @@ namespace Sensors
     // Sensing input circuit voltage divider PULLUP resistance(Use whatever your circuit has)
     constexpr uint16_t PULLUP_FIXED_RESISTOR_OHMS = 12700;  // 12.7K in series with the NTC
 
+    // Auto-ranging divider: 5V -> 100K (always) -> junction, plus 14.7K from a GPIO to the junction.
+    //  - GPIO Hi-Z    -> 100K pullup  (cold end, ~400K @ -40°C reads 400/500 = 80% of scale ~= 818 counts:
+    //                    high range kept down to RANGE_SWITCH_LOW_COUNTS, the 12.8K pullup would read ~97%)
+    //  - GPIO HIGH    -> 100K || 14.7K ~= 12.8K pullup (warm end, same as the single pullup circuit)
+    constexpr uint32_t PULLUP_HIGH_RANGE_OHMS = 100000;     // Pullup permanently tied to V_REF
+    constexpr uint32_t PULLUP_SWITCHED_OHMS   = 14700;      // Pullup driven by Pins::*_PULLUP_SWITCH_PIN
+
+    // Sentinel for an invalid/error reading (temperature_x10 domain)
+    constexpr int16_t INVALID_READING_X10 = -32768;
+
     // NTC thermistor Model
     constexpr int8_t LUT_TEMPERATURE_MIN_C  = -40;
     constexpr uint8_t LUT_TEMPERATURE_MAX_C =  40;
     constexpr uint8_t LUT_STEP_C            =   1;
 }
 
+namespace Sampling
+{
+    // SensorArray schedules (ms between acquisitions per channel, 0 -> disabled)
+    constexpr uint8_t  MAX_CHANNELS              = 16;      // Upper bound for SensorArray<N>
+    constexpr uint32_t COMPARTMENT_PERIOD_MS     = 2000;    // Fridge compartment probe
+    constexpr uint32_t EVAPORATOR_PERIOD_MS      = 2000;    // Evaporator probe
+
+    // ReadingHistory: samples kept per sensor for the rolling mean/min/max (60 s at 2 s, ~120 bytes of RAM)
+    constexpr uint16_t HISTORY_CAPACITY          = 30;
+
+    // TemperatureSensor::onChange(): report only moves beyond the deadband, plus a heartbeat
+    constexpr int16_t  NOTIFY_DEADBAND_X10       = 2;       // 0.2°C (about the filtered noise floor)
+    constexpr uint32_t NOTIFY_MAX_SILENCE_MS     = 60000;   // At least one report per minute
+
+    // Rate of change (RateEstimator): least-squares slope over the last RATE_WINDOW readings
+    constexpr uint8_t  RATE_WINDOW               = 16;      // 32 s at 2 s per reading (defrost termination, door-open detection)
+    constexpr uint8_t  RATE_TIME_SHIFT           = 6;       // Time resolution 64 ms -> up to 4095 * 64 ms = 262 s between oldest and newest
+}
+
 namespace Filtering
 {
     constexpr float   EMA_ALPHA_DEFAULT  = 0.15f;   // 0.0 -> No smoothing/ 1.0 -> No history
+    constexpr uint8_t EMA_ALPHA_SHIFT_DEFAULT = 3;  // Fixed-point EMA: alpha = 2^-3 = 0.125 (closest shift to 0.15)
+    constexpr uint8_t EMA_ALPHA_Q8_DEFAULT    = 38; // Fixed-point EMA: alpha = 38/256 ~= 0.148
+    constexpr uint8_t EMA_FRAC_BITS           = 8;  // Extra fractional bits kept in the fixed-point EMA state
     constexpr uint8_t SMA_WINDOW_DEFAULT = 8 ;      // Effective smoothing length
+    constexpr bool    WARMUP_DEFAULT     = true;    // EMA: weight 1/n until n reaches 1/alpha (fast convergence after boot)
+
+    // 1-D Kalman filter, noise variances in (0.1°C)^2 -> same units as temperature_x10
+    // Level only (default): no overshoot, settles a 10 °C step in ~33 readings (tools/filter_bench).
+    // Level + rate: no ramp lag, but a 10 °C door-open step overshoots by ~1.7 °C, settles in ~68 readings
+    // and a single glitch disturbs ~57 readings: only for ramp tracking behind an outlier stage.
+    constexpr float   KALMAN_MEASUREMENT_NOISE = 4.0f;      // R: reading noise variance (sigma = 0.2°C)
+    constexpr float   KALMAN_PROCESS_NOISE     = 0.05f;     // Q: level random walk per sample
+    constexpr float   KALMAN_RATE_NOISE        = 0.0001f;   // Q_rate: rate random walk per sample (rate state only)
+    constexpr bool    KALMAN_USE_RATE          = false;     // true -> level + rate model (ramps without lag, step overshoot)
+
+    // Hampel outlier rejection: replace x when |x - median| > k * 1.4826 * MAD
+    constexpr uint8_t HAMPEL_WINDOW          = 5;   // Samples in the window (3, 5 or 7: fixed sorting networks)
+    constexpr uint8_t HAMPEL_THRESHOLD_Q4    = 71;  // k * 1.4826 in Q4 (k = 3 -> 4.45 -> 71/16)
+    constexpr uint8_t HAMPEL_MIN_DEVIATION   = 3;   // Never reject below 0.3°C (MAD is 0 on a flat signal)
+
+    // Adaptive EMA: alpha doubles from MIN for every doubling of |innovation| above NOISE_GATE * noise, up to MAX
+    constexpr uint8_t ADAPTIVE_ALPHA_MIN_Q8   = 16;     // Steady state alpha = 16/256 (heavy smoothing)
+    constexpr uint8_t ADAPTIVE_ALPHA_MAX_Q8   = 192;    // Transient alpha = 192/256 (fast tracking)
+    constexpr uint8_t ADAPTIVE_NOISE_GATE     = 2;      // |innovation| below 2 * noise is treated as noise
+    constexpr uint8_t ADAPTIVE_NOISE_SHIFT    = 4;      // Noise tracker: mean |innovation| with weight 2^-4
+    constexpr uint8_t ADAPTIVE_NOISE_FLOOR_Q8 = 128;    // Noise never below 0.5 LSB (quantized flat signal)
+
+    // Probe-lag compensation: air = probe + tau * d(probe)/dt (first-order probe model, tau measured per probe)
+    constexpr uint32_t PROBE_TAU_COMPARTMENT_MS = 30000;    // Potted compartment probe in still air
+    constexpr uint32_t PROBE_TAU_EVAPORATOR_MS  = 20000;    // Evaporator probe clamped on the fins (better coupling)
+    constexpr uint8_t  LAG_DERIVATIVE_SHIFT     = 2;        // Slope smoothing: EMA weight 2^-2 over the per-reading slope
+    constexpr int16_t  LAG_MAX_CORRECTION_X10   = 50;       // Never move the estimate more than 5.0°C from the probe
 }
 
 namespace Control
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <stdint.h>             // int8_t
+#include <avr/pgmspace.h>       // PROGMEM
+#include "config/Config.h"      // Adc::CORRECTION_KNOTS
+
+/**
+ * @brief Per-board ADC integral nonlinearity (INL/DNL) correction curve
+ * 
+ * @details
+ *  - One signed correction (in ADC counts) per knot, knots evenly spaced every 2^Adc::CORRECTION_KNOT_SHIFT counts
+ *    starting at 0 (last knot is the virtual 1024 code so the last segment can be interpolated).
+ *  - corrected = raw + lerp(knot[raw >> shift], knot[(raw >> shift) + 1])
+ *  - Stored in flash (PROGMEM) and read with pgm_read_byte(): 17 bytes for a 10-bit ADC.
+ * 
+ * How to calibrate (once per board, at the factory):
+ *  1. Feed a precision reference (or a calibrated divider) to the ADC pin at each knot code.
+ *  2. Record the averaged raw code the board returns.
+ *  3. Store (ideal - measured) for each knot, saturated to [-128, 127].
+ *
+ * @note The default curve is all zeros (identity) so uncalibrated boards read as before.
+ */
+static const int8_t ADC_INL_CORRECTION[Adc::CORRECTION_KNOTS] PROGMEM = {
+    0,  // 0
+    0,  // 64
+    0,  // 128
+    0,  // 192
+    0,  // 256
+    0,  // 320
+    0,  // 384
+    0,  // 448
+    0,  // 512
+    0,  // 576
+    0,  // 640
+    0,  // 704
+    0,  // 768
+    0,  // 832
+    0,  // 896
+    0,  // 960
+    0   // 1024
+};
@@ -137,7 +137,8 @@ namespace lut_utils
             // Adjust new bound for the next iteration
             if (goLeft) 
             {
-                right = mid - 1;    // Move to left half
+                if (mid == 0) break;    // Before the first entry: right = mid - 1 would wrap around (size_t)
+                right = mid - 1;        // Move to left half
             }
             else
             {
@@ -174,9 +175,9 @@ namespace lut_utils
         result.foundExact = false;
 
         // For Debugging
-        if (result.foundExact)      LOGD("binarySearchLut: Found exact match at index %d", result.exactIdx);
-        else if (result.outOfRange) LOGD("binarySearchLut: Target out of range, clamped=%d, lowerIdx=%d, upperIdx=%d", result.clamped, result.lowerIdx, result.upperIdx);
-        else                        LOGD("binarySearchLut: Bracketing found: [%d..%d] for target %d (clamped=%s)", result.lowerIdx, result.upperIdx, (unsigned long)target, (result.clamped)?"false":"true");
+        if (result.foundExact)      LOGD_LUT("binarySearchLut: Found exact match at index %d", result.exactIdx);
+        else if (result.outOfRange) LOGD_LUT("binarySearchLut: Target out of range, clamped=%d, lowerIdx=%d, upperIdx=%d", result.clamped, result.lowerIdx, result.upperIdx);
+        else                        LOGD_LUT("binarySearchLut: Bracketing found: [%d..%d] for target %d (clamped=%s)", result.lowerIdx, result.upperIdx, (unsigned long)target, (result.clamped)?"false":"true");
 
         // Finally return result
         return result;
@@ -210,7 +211,7 @@ namespace lut_utils
         // Validate deltas to avoid division by zero
         if(r_cold_x10 == r_hot_x10) 
         {
-            LOGE("applyLinearInterpolation: Error - r_cold (%ld) equals r_hot (%ld), cannot interpolate.", (long)r_cold_x10, (long)r_hot_x10);
+            LOGE_LUT("applyLinearInterpolation: Error - r_cold (%ld) equals r_hot (%ld), cannot interpolate.", (long)r_cold_x10, (long)r_hot_x10);
             return t_cold_x10; // or t_hot_x10, they are the same point
         }
 
@@ -229,7 +230,7 @@ namespace lut_utils
         // Clamp to prevent overflow/underflow if interpolated temp is out of range (based on LUT limits)
         if(t_interpolated_x10 < Sensors::LUT_TEMPERATURE_MIN_C * 10LL || t_interpolated_x10 > Sensors::LUT_TEMPERATURE_MAX_C * 10LL)
         {
-            LOGW("applyLinearInterpolation: Warning - Interpolated temperature %ld (x10) is out of expected range [%d x10 .. %d x10], clamping.",
+            LOGW_LUT("applyLinearInterpolation: Warning - Interpolated temperature %ld (x10) is out of expected range [%d x10 .. %d x10], clamping.",
                 (long)t_interpolated_x10,
                 Sensors::LUT_TEMPERATURE_MIN_C * 10,
                 Sensors::LUT_TEMPERATURE_MAX_C * 10
@@ -245,10 +246,10 @@ namespace lut_utils
 
 
         // For debugging
-        LOGD("applyLinearInterpolation: r_measured=%ld, r_cold=%ld, r_hot=%ld, t_cold=%ld, t_hot=%ld", 
+        LOGD_LUT("applyLinearInterpolation: r_measured=%ld, r_cold=%ld, r_hot=%ld, t_cold=%ld, t_hot=%ld", 
             (long)r_measured_x10, (long)r_cold_x10, (long)r_hot_x10, (long)t_cold_x10, (long)t_hot_x10);
 
-        LOGD("applyLinearInterpolation: Interpolated Temperature x10: %ld", (long)t_interpolated_x10);
+        LOGD_LUT("applyLinearInterpolation: Interpolated Temperature x10: %ld", (long)t_interpolated_x10);
 
         return static_cast<Temp>(t_interpolated_x10);
     }
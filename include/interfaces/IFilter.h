@@ -1,5 +1,13 @@
 #pragma once
 
+#include <stdint.h>
+
+/// @brief Warm-up switch of the seeding filters (a distinct type: an initial value or alpha never converts to it)
+enum class WarmUp : bool
+{
+    Off = false,
+    On  = true
+};
 
 /**
  * @brief Abstract signal filter interface
@@ -18,4 +26,22 @@ class IFilter
         /// @param new_value - new value to be filter
         /// @return T        - filtered value
         virtual T apply(T new_value) = 0;
-};
\ No newline at end of file
+
+        /// @brief Apply with the acquisition time of the sample: filters whose model depends on the time
+        ///        between samples override it (LagCompensationFilter), the others ignore the time
+        /// @param new_value    - new value to be filter
+        /// @param timestamp_ms - millis() of the acquisition (Reading::timestamp_ms)
+        /// @return T           - filtered value
+        virtual T applyAt(T new_value, uint32_t timestamp_ms)
+        {
+            (void)timestamp_ms;
+            return apply(new_value);
+        }
+
+        /// @brief Forget the filter history: the next apply() seeds the state from its input
+        virtual void reset() {}
+
+        /// @brief True once the output has converged after seeding (warm-up finished)
+        /// @note Stateless/instant filters are always settled
+        virtual bool isSettled() const { return true; }
+};
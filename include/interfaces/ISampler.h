@@ -15,7 +15,35 @@ public:
      *  - Accumulates M consecutive samples.
      *  - Average them 
      * 
-     * @return uint16_t - The average/filter raw ADC value 
+     * @return uint16_t - The average/filter raw ADC value, Adc::INVALID_SAMPLE when nothing could be acquired
+     *                    (configuration error, not a wiring fault)
      */
     virtual uint16_t sample() = 0;
+
+    /**
+     * @brief Split-phase acquisition, step 1: start a new acquisition and return immediately
+     * 
+     * @note Default: nothing to start, the blocking sample() runs on the first pollSample()
+     */
+    virtual void startSample() {}
+
+    /**
+     * @brief Split-phase acquisition, step 2: advance the acquisition without blocking
+     * 
+     * @param adc_raw - Receives the same value sample() would return, once ready
+     * @return true  - Acquisition complete, adc_raw is valid
+     * @return false - Still running (call again later)
+     */
+    virtual bool pollSample(uint16_t& adc_raw)
+    {
+        adc_raw = sample();
+        return true;
+    }
+
+    /**
+     * @brief Split-phase acquisition: abandon the pending acquisition and release what it holds (e.g. the ADC)
+     * 
+     * @note Default: nothing is held between calls
+     */
+    virtual void cancelSample() {}
 };
\ No newline at end of file
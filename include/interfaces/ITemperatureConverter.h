@@ -2,6 +2,8 @@
 
 #include<stdint.h>
 
+#include "Model/TemperatureResult.h"    // Value + status result
+
 /**
  * @brief Abstract interface for Temperature Converter implementations
  * 
@@ -10,7 +12,7 @@
  *  - Example: 
  *      - 100 means 10.0°C
  *      - 40 means -4.0°C
- *     - -32768 means Sentinel value for error / out of range
+ *     - Sensors::INVALID_READING_X10 (-32768) means Sentinel value for error / out of range
  */
 class ITemperatureConverter 
 {
@@ -23,4 +25,15 @@ class ITemperatureConverter
         /// @param resistance_x10 - Resistance in 0.1Ω resolution (x10)
         /// @return Temperature in Celsius in a max. range -40.0°C to +40.0°C scaled by 10 (0.1°C resolution). Use int16_t to cover -400 to +400 range
         virtual int16_t convertToTemperature_x10(uint32_t resistance_x10) const noexcept = 0;
+
+        /// @brief Same conversion keeping the reason of a failure/clamp (BelowTable, AboveTable, ConversionError)
+        /// @param resistance_x10 - Resistance in 0.1Ω resolution (x10)
+        /// @return Temperature (0.1°C) + status. Default: sentinel -> ConversionError, anything else -> Ok
+        virtual TemperatureResult convertToTemperature(uint32_t resistance_x10) const noexcept
+        {
+            TemperatureResult result;
+            result.value_x10 = convertToTemperature_x10(resistance_x10);
+            result.status = (result.value_x10 == Sensors::INVALID_READING_X10) ? ReadingStatus::ConversionError : ReadingStatus::Ok;
+            return result;
+        }
 };
\ No newline at end of file
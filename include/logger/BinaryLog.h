@@ -0,0 +1,179 @@
+// ====================================================================
+// BinaryLog.h
+// Deferred binary logging for Logger.h (LOG_BINARY=1)
+//
+// Features:
+//   - No formatting on the device: a log call copies the message ID, millis(),
+//     the level and the raw argument bytes into a RAM ring (a few microseconds)
+//   - Message ID = flash address of the PSTR() format string: unique per call
+//     site, fixed at link time, nothing to maintain by hand
+//   - LOG_FLUSH() moves the ring to the output (LogTx ring or Serial) without
+//     ever blocking
+//   - tools/log_decoder rebuilds the text on the host, taking the format
+//     strings from the firmware image (the format table is generated by the
+//     build itself, so it always matches the flashed firmware)
+//
+// Frame on the wire (little endian):
+//   [FRAME_SYNC][len][id:2][millis:4][level:1][args...][xor of payload]
+//   len counts the payload only (id..args). Each argument is a type tag
+//   followed by its value, so a %d given a long still decodes correctly:
+//     TAG_I16/TAG_U16/TAG_PTR: 2 bytes, TAG_I32/TAG_U32/TAG_F32: 4 bytes,
+//     TAG_STR: bytes up to and including the NUL (truncated to fit the frame)
+//   id == DROP_RECORD_ID: "records dropped" marker, one TAG_U16 count.
+//
+// Notes:
+//   - Log from the main context only (the ring is not shared with ISRs).
+//   - When the ring is full the new record is dropped and counted; the count
+//     is sent as a marker frame once there is room again.
+// ====================================================================
+#pragma once
+
+#if defined(ARDUINO)
+    #include <Arduino.h>
+    #include <avr/pgmspace.h>
+#endif
+#include <stdint.h>
+#include <string.h>
+
+// --------------------------------------------------------------------
+// Configuration (override from platformio.ini)
+// --------------------------------------------------------------------
+#ifndef LOG_BINARY_RING_SIZE
+    #define LOG_BINARY_RING_SIZE 256        // Bytes of RAM for pending frames
+#endif
+
+#ifndef LOG_BINARY_MAX_FRAME
+    #define LOG_BINARY_MAX_FRAME 48         // Largest frame (framing + header + args)
+#endif
+
+namespace logger
+{
+namespace binary
+{
+    // --- Wire protocol (shared with tools/log_decoder) ---
+    constexpr uint8_t  FRAME_SYNC      = 0xA5;
+    constexpr uint8_t  FRAME_OVERHEAD  = 3;     // sync + len + checksum
+    constexpr uint8_t  HEADER_SIZE     = 7;     // id + millis + level
+    constexpr uint16_t DROP_RECORD_ID  = 0;     // Never a flash address of a format string
+
+    enum ArgTag : uint8_t
+    {
+        TAG_I16 = 1,
+        TAG_U16 = 2,
+        TAG_I32 = 3,
+        TAG_U32 = 4,
+        TAG_F32 = 5,
+        TAG_STR = 6,
+        TAG_PTR = 7
+    };
+
+    static_assert(LOG_BINARY_MAX_FRAME <= 255 && LOG_BINARY_MAX_FRAME > FRAME_OVERHEAD + HEADER_SIZE,
+                  "BinaryLog: LOG_BINARY_MAX_FRAME must fit the header and a length byte");
+    static_assert(LOG_BINARY_RING_SIZE >= LOG_BINARY_MAX_FRAME && LOG_BINARY_RING_SIZE <= 32767,
+                  "BinaryLog: LOG_BINARY_RING_SIZE must hold at least one frame");
+
+#if defined(ARDUINO)
+
+    // --- Ring (src/logger/Logger.cpp) ---
+    bool     push(const uint8_t* frame, uint8_t size);   // All or nothing: false (and counted) when full
+    void     flush();                                    // Send what the output accepts, never blocks
+    uint16_t room();                                     // Largest frame push() accepts right now
+    uint16_t dropped();                                  // Records dropped since boot (saturates)
+
+    /**
+     * @brief One frame being built on the stack, committed to the ring in one copy
+     */
+    class Record
+    {
+        public:
+
+            Record(char level, PGM_P fmt): size_(2)
+            {
+                const uint16_t id = static_cast<uint16_t>(reinterpret_cast<uintptr_t>(fmt));
+                const uint32_t now = millis();
+
+                frame_[0] = FRAME_SYNC;
+                putBytes(&id, 2);
+                putBytes(&now, 4);
+                frame_[size_++] = static_cast<uint8_t>(level);
+            }
+
+            // Overload resolution on the types log_binary() deduced (no variadic default promotions here):
+            // bool/char/short and unscoped enums pick put(int) by integral promotion, float put(double),
+            // other pointers put(const void*). Scoped enums, long long and nullptr have no unique match
+            // and do not compile: cast them.
+            void put(int v)                 { putInteger(static_cast<uint32_t>(v), sizeof(v), true); }
+            void put(unsigned int v)        { putInteger(static_cast<uint32_t>(v), sizeof(v), false); }
+            void put(long v)                { putInteger(static_cast<uint32_t>(v), sizeof(v), true); }
+            void put(unsigned long v)       { putInteger(static_cast<uint32_t>(v), sizeof(v), false); }
+
+            void put(double v)
+            {
+                const float f = static_cast<float>(v);
+                if(!fits(5)) return;
+                frame_[size_++] = TAG_F32;
+                putBytes(&f, 4);
+            }
+
+            void put(const void* p)
+            {
+                const uint16_t address = static_cast<uint16_t>(reinterpret_cast<uintptr_t>(p));
+                if(!fits(3)) return;
+                frame_[size_++] = TAG_PTR;
+                putBytes(&address, 2);
+            }
+
+            void put(const char* s)
+            {
+                if(!fits(2)) return;                // Tag + NUL at least
+                frame_[size_++] = TAG_STR;
+                if(!s) s = "(null)";
+                while(*s && fits(2)) frame_[size_++] = static_cast<uint8_t>(*s++);
+                frame_[size_++] = 0;
+            }
+
+            /// @brief Seal the frame (length + checksum) and queue it
+            void commit()
+            {
+                frame_[1] = static_cast<uint8_t>(size_ - 2);
+                uint8_t checksum = 0;
+                for(uint8_t i = 2; i < size_; ++i) checksum ^= frame_[i];
+                frame_[size_++] = checksum;
+                push(frame_, size_);
+            }
+
+        private:
+
+            /// @brief Room for n more bytes, keeping one for the checksum
+            bool fits(uint8_t n) const { return static_cast<uint16_t>(size_) + n < LOG_BINARY_MAX_FRAME; }
+
+            void putBytes(const void* bytes, uint8_t n)
+            {
+                memcpy(&frame_[size_], bytes, n);   // AVR is little endian: the wire order
+                size_ += n;
+            }
+
+            void putInteger(uint32_t bits, uint8_t width, bool is_signed)
+            {
+                const uint8_t n = (width <= 2) ? 2 : 4;
+                if(!fits(n + 1)) return;
+                frame_[size_++] = (n == 2) ? (is_signed ? TAG_I16 : TAG_U16) : (is_signed ? TAG_I32 : TAG_U32);
+                putBytes(&bits, n);                 // Low bytes first
+            }
+
+            uint8_t frame_[LOG_BINARY_MAX_FRAME];
+            uint8_t size_;
+    };
+
+    template<typename... Args>
+    inline void log_binary(char level, PGM_P fmt, Args... args)
+    {
+        Record record(level, fmt);
+        (record.put(args), ...);
+        record.commit();
+    }
+
+#endif // ARDUINO
+
+} // namespace binary
+} // namespace logger
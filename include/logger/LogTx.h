@@ -0,0 +1,55 @@
+// ====================================================================
+// LogTx.h
+// Interrupt-driven, non-blocking serial output for Logger.h (LOG_TX_RING=1)
+//
+// Features:
+//   - The logger owns USART0 TX: messages are copied into a RAM ring and the
+//     data-register-empty interrupt (USART_UDRE_vect) sends them byte by byte
+//   - A log call never waits for the UART: when the ring is full the overflow
+//     policy decides which whole message is lost, and the loss is counted
+//       LOG_DROP_NEWEST: the incoming message is dropped (default, cheapest)
+//       LOG_DROP_OLDEST: the oldest queued messages are evicted to make room;
+//                        a line already on the wire is cut and ended with '\n'
+//   - dropped() exposes the count (LOG_DROPPED() in Logger.h) for telemetry
+//
+// Notes:
+//   - HardwareSerial defines the same interrupt: with LOG_TX_RING=1 the
+//     application must not reference Serial (use LOG_BEGIN() instead of
+//     Serial.begin()). Set LOG_TX_RING=0 to go back to Serial (blocking).
+//   - TX only: the RX pin is left free.
+//   - Each queued message costs one extra byte (its length) in the ring.
+// ====================================================================
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+// --------------------------------------------------------------------
+// Configuration (override from platformio.ini)
+// --------------------------------------------------------------------
+#define LOG_DROP_NEWEST 0
+#define LOG_DROP_OLDEST 1
+
+#ifndef LOG_TX_RING_SIZE
+    #define LOG_TX_RING_SIZE 256            // Bytes of RAM for queued output (replaces Serial's 2 x 64-byte buffers)
+#endif
+
+#ifndef LOG_TX_OVERFLOW
+    #define LOG_TX_OVERFLOW LOG_DROP_NEWEST
+#endif
+
+static_assert(LOG_TX_RING_SIZE >= 64 && LOG_TX_RING_SIZE <= 32767, "LogTx: LOG_TX_RING_SIZE must be 64..32767");
+static_assert(LOG_TX_OVERFLOW == LOG_DROP_NEWEST || LOG_TX_OVERFLOW == LOG_DROP_OLDEST, "LogTx: unknown LOG_TX_OVERFLOW policy");
+
+#if defined(ARDUINO)
+namespace logger
+{
+namespace tx
+{
+    void     begin(uint32_t baud);                      // USART0 8N1, TX only, interrupt driven
+    bool     write(const char* bytes, size_t size);     // Queue one message (1..255 bytes) whole, never blocks
+    uint16_t room();                                    // Largest message write() accepts right now without dropping
+    uint16_t dropped();                                 // Messages lost to the overflow policy since boot (saturates)
+}
+}
+#endif // ARDUINO
@@ -6,19 +6,40 @@
 //   - Levels: I / W / E / D
 //   - Optional timestamp (millis)
 //   - Compile-time disable (LOG_ENABLE=0 -> logs compiled out)
+//   - Compile-time thresholds: LOG_LEVEL for plain LOGx(), LOG_LEVEL_LUT /
+//     LOG_LEVEL_ADC / LOG_LEVEL_SENSOR for LOGx_LUT() / LOGx_ADC() / LOGx_SENSOR()
+//     (calls below the threshold compile to nothing, arguments included)
 //   - Format strings stored in flash using PSTR() + vsnprintf_P()
+//   - Binary mode (LOG_BINARY=1): no formatting on the device, records queued
+//     in a RAM ring and decoded on the host (see BinaryLog.h, tools/log_decoder)
+//   - Non-blocking output (LOG_TX_RING=1, default): lines go to a RAM ring sent
+//     by the UART interrupt, overflow drops whole messages (see LogTx.h)
 //
 // Notes:
 //   - LOGI/LOGW/LOGE/LOGD expect the first argument to be a *string literal*
 //     (so PSTR(...) works). Example: LOGE("Bad value %d", x);
 //   - For plain messages with no formatting, prefer LOG*_SIMPLE("...").
+//   - Start the output with LOG_BEGIN(baud) instead of Serial.begin(baud).
+//   - Call LOG_FLUSH() once per loop(): it sends the queued binary records
+//     (no-op in text mode).
+//   - LOG_DROPPED(): messages lost to a full ring since boot (telemetry).
+//   - LOG_FITS(size): the output takes a size-byte message right now without
+//     dropping (gate telemetry on it, so reporting drops never causes new ones).
+//   - Host builds (no ARDUINO define, e.g. tools/filter_bench) have no Serial:
+//     logs are always compiled out there.
 // ====================================================================
 #pragma once
 
-#include <Arduino.h>
-#include <avr/pgmspace.h>
+#if defined(ARDUINO)
+    #include <Arduino.h>
+    #include <avr/pgmspace.h>
+#else
+    #undef  LOG_ENABLE
+    #define LOG_ENABLE 0
+#endif
 #include <stdarg.h>
 #include <stdio.h>
+#include <string.h>
 
 // --------------------------------------------------------------------
 // Configuration (override from platformio.ini with -DLOG_ENABLE=..., etc.)
@@ -27,6 +48,33 @@
     #define LOG_ENABLE 1
 #endif
 
+// Levels: a call is compiled in when its level <= the threshold of its module
+#define LOG_LEVEL_NONE      0
+#define LOG_LEVEL_ERROR     1
+#define LOG_LEVEL_WARN      2
+#define LOG_LEVEL_INFO      3
+#define LOG_LEVEL_DEBUG     4
+
+#ifndef LOG_LEVEL
+    #define LOG_LEVEL LOG_LEVEL_DEBUG           // Plain LOGx() calls and modules without their own threshold
+#endif
+
+#ifndef LOG_LEVEL_LUT
+    #define LOG_LEVEL_LUT LOG_LEVEL
+#endif
+
+#ifndef LOG_LEVEL_ADC
+    #define LOG_LEVEL_ADC LOG_LEVEL
+#endif
+
+#ifndef LOG_LEVEL_SENSOR
+    #define LOG_LEVEL_SENSOR LOG_LEVEL
+#endif
+
+#if LOG_LEVEL < LOG_LEVEL_NONE || LOG_LEVEL > LOG_LEVEL_DEBUG || LOG_LEVEL_LUT > LOG_LEVEL_DEBUG || LOG_LEVEL_ADC > LOG_LEVEL_DEBUG || LOG_LEVEL_SENSOR > LOG_LEVEL_DEBUG
+    #error "Logger: log levels must be LOG_LEVEL_NONE..LOG_LEVEL_DEBUG"
+#endif
+
 #ifndef LOG_TIMESTAMP
     #define LOG_TIMESTAMP 1
 #endif
@@ -35,47 +83,70 @@
     #define LOG_BUFFER_SIZE 192
 #endif
 
+#ifndef LOG_BINARY
+    #define LOG_BINARY 0
+#endif
+
+#ifndef LOG_TX_RING
+    #define LOG_TX_RING 1
+#endif
+
+#if LOG_ENABLE && LOG_BINARY
+    #include "logger/BinaryLog.h"
+#endif
+
+#if LOG_ENABLE && LOG_TX_RING
+    #include "logger/LogTx.h"
+    static_assert(LOG_BUFFER_SIZE <= 255, "Logger: LOG_BUFFER_SIZE must be <= 255 with LOG_TX_RING (one ring message per line)");
+#endif
+
+#if defined(ARDUINO)
 namespace logger
 {
-    inline void printPrefix(char level)
+    // Send one complete message: interrupt-driven ring (never blocks) or Serial (blocks once its buffer is full)
+    inline void out(const char* bytes, size_t size)
     {
-    #if LOG_TIMESTAMP
-        Serial.print('[');
-        Serial.print(millis());
-        Serial.print(F(" ms] "));
+    #if LOG_ENABLE && LOG_TX_RING
+        tx::write(bytes, size);
+    #else
+        Serial.write(reinterpret_cast<const uint8_t*>(bytes), size);
     #endif
-        Serial.print('[');
-        Serial.print(level);
-        Serial.print(F("] "));
     }
 
-    // Print a formatted log message.
-    // fmt is a PROGMEM pointer (PGM_P) so we can keep format strings in flash.
-    inline void log_vprintf_P(char level, PGM_P fmt, va_list ap)
+    // Write the "[<ms> ms] [<level>] " prefix, return its length.
+    inline size_t formatPrefix(char* buf, size_t size, char level)
     {
-        char buf[LOG_BUFFER_SIZE];
-
-        // Build a RAM prefix first.
-        int n = 0;
     #if LOG_TIMESTAMP
-        n = snprintf(buf, sizeof(buf), "[%lu ms] [%c] ", (unsigned long)millis(), level);
+        const int n = snprintf(buf, size, "[%lu ms] [%c] ", (unsigned long)millis(), level);
     #else
-        n = snprintf(buf, sizeof(buf), "[%c] ", level);
+        const int n = snprintf(buf, size, "[%c] ", level);
     #endif
+        if (n < 0) { buf[0] = '\0'; return 0; }
+        return (static_cast<size_t>(n) >= size) ? (size - 1u) : static_cast<size_t>(n);
+    }
 
-        if (n < 0) {
-            // snprintf failed, fall back to direct printing.
-            printPrefix(level);
-            Serial.println(F("<snprintf failed>"));
-            return;
-        }
+    // Terminate the line (println semantics) and send it as one message.
+    // buf must have 2 spare bytes after the text (callers format into sizeof(buf) - 2).
+    inline void outLine(char* buf, size_t used)
+    {
+        buf[used++] = '\r';
+        buf[used++] = '\n';
+        out(buf, used);
+    }
 
-        size_t used = (static_cast<size_t>(n) >= sizeof(buf)) ? (sizeof(buf) - 1u) : static_cast<size_t>(n);
+    // Print a formatted log message.
+    // fmt is a PROGMEM pointer (PGM_P) so we can keep format strings in flash.
+    inline void log_vprintf_P(char level, PGM_P fmt, va_list ap)
+    {
+        char buf[LOG_BUFFER_SIZE];
+        const size_t text = sizeof(buf) - 2;
 
-        // Append formatted message from PROGMEM format string.
-        vsnprintf_P(buf + used, sizeof(buf) - used, fmt, ap);
+        // Build a RAM prefix first, then append the formatted message from the PROGMEM format string.
+        size_t used = formatPrefix(buf, text, level);
+        vsnprintf_P(buf + used, text - used, fmt, ap);
+        used += strlen(buf + used);
 
-        Serial.println(buf);
+        outLine(buf, used);
     }
 
     inline void log_printf_P(char level, PGM_P fmt, ...)
@@ -89,44 +160,211 @@ namespace logger
     // Plain message stored in flash (fast + small SRAM impact)
     inline void log_simple_P(char level, const __FlashStringHelper* msg)
     {
-        printPrefix(level);
-        Serial.println(msg);
+        char buf[LOG_BUFFER_SIZE];
+        const size_t text = sizeof(buf) - 2;
+
+        size_t used = formatPrefix(buf, text, level);
+        strncpy_P(buf + used, reinterpret_cast<PGM_P>(msg), text - used - 1);
+        buf[text - 1] = '\0';
+        used += strlen(buf + used);
+
+        outLine(buf, used);
     }
 }
+#endif // ARDUINO
 
 // --------------------------------------------------------------------
-// Public macros
+// Output macros (ungated: use the LOG* macros below)
 // --------------------------------------------------------------------
-#if LOG_ENABLE
+#if LOG_ENABLE && LOG_BINARY
+
+    // Binary records: ID (format string address) + millis + level + raw arguments
+    #define LOG_EMIT_I(fmt, ...)  logger::binary::log_binary('I', PSTR(fmt), ##__VA_ARGS__)
+    #define LOG_EMIT_W(fmt, ...)  logger::binary::log_binary('W', PSTR(fmt), ##__VA_ARGS__)
+    #define LOG_EMIT_E(fmt, ...)  logger::binary::log_binary('E', PSTR(fmt), ##__VA_ARGS__)
+    #define LOG_EMIT_D(fmt, ...)  logger::binary::log_binary('D', PSTR(fmt), ##__VA_ARGS__)
+
+    #define LOG_EMIT_SIMPLE_I(msg_literal) logger::binary::log_binary('I', PSTR(msg_literal))
+    #define LOG_EMIT_SIMPLE_W(msg_literal) logger::binary::log_binary('W', PSTR(msg_literal))
+    #define LOG_EMIT_SIMPLE_E(msg_literal) logger::binary::log_binary('E', PSTR(msg_literal))
+    #define LOG_EMIT_SIMPLE_D(msg_literal) logger::binary::log_binary('D', PSTR(msg_literal))
+
+    // Raw characters would break the frames
+    #define LOG_DOT()           do {} while (0)
+
+    // Send queued records (call once per loop)
+    #define LOG_FLUSH()         logger::binary::flush()
+
+#elif LOG_ENABLE
 
     // Formatted logs (printf-style).
     // GNU extension used to swallow the comma when no extra args are provided.
     // If -Wpedantic complains, use the *_SIMPLE macros for no-arg logs,
     // or compile with -Wno-gnu-zero-variadic-macro-arguments.
-    #define LOGI(fmt, ...)  logger::log_printf_P('I', PSTR(fmt), ##__VA_ARGS__)
-    #define LOGW(fmt, ...)  logger::log_printf_P('W', PSTR(fmt), ##__VA_ARGS__)
-    #define LOGE(fmt, ...)  logger::log_printf_P('E', PSTR(fmt), ##__VA_ARGS__)
-    #define LOGD(fmt, ...)  logger::log_printf_P('D', PSTR(fmt), ##__VA_ARGS__)
+    #define LOG_EMIT_I(fmt, ...)  logger::log_printf_P('I', PSTR(fmt), ##__VA_ARGS__)
+    #define LOG_EMIT_W(fmt, ...)  logger::log_printf_P('W', PSTR(fmt), ##__VA_ARGS__)
+    #define LOG_EMIT_E(fmt, ...)  logger::log_printf_P('E', PSTR(fmt), ##__VA_ARGS__)
+    #define LOG_EMIT_D(fmt, ...)  logger::log_printf_P('D', PSTR(fmt), ##__VA_ARGS__)
 
     // Plain message logs (no formatting)
-    #define LOGI_SIMPLE(msg_literal) logger::log_simple_P('I', F(msg_literal))
-    #define LOGW_SIMPLE(msg_literal) logger::log_simple_P('W', F(msg_literal))
-    #define LOGE_SIMPLE(msg_literal) logger::log_simple_P('E', F(msg_literal))
-    #define LOGD_SIMPLE(msg_literal) logger::log_simple_P('D', F(msg_literal))
+    #define LOG_EMIT_SIMPLE_I(msg_literal) logger::log_simple_P('I', F(msg_literal))
+    #define LOG_EMIT_SIMPLE_W(msg_literal) logger::log_simple_P('W', F(msg_literal))
+    #define LOG_EMIT_SIMPLE_E(msg_literal) logger::log_simple_P('E', F(msg_literal))
+    #define LOG_EMIT_SIMPLE_D(msg_literal) logger::log_simple_P('D', F(msg_literal))
 
     // Progress dots (useful during long init)
-    #define LOG_DOT() do { Serial.print('.'); } while (0)
+    #define LOG_DOT() logger::out(".", 1)
+
+    // Text lines are handed to the output as they are logged
+    #define LOG_FLUSH()         do {} while (0)
 
 #else
 
-    #define LOGI(... )          do {} while (0)
-    #define LOGW(... )          do {} while (0)
-    #define LOGE(... )          do {} while (0)
-    #define LOGD(... )          do {} while (0)
-    #define LOGI_SIMPLE(... )   do {} while (0)
-    #define LOGW_SIMPLE(... )   do {} while (0)
-    #define LOGE_SIMPLE(... )   do {} while (0)
-    #define LOGD_SIMPLE(... )   do {} while (0)
-    #define LOG_DOT()           do {} while (0)
+    #define LOG_EMIT_I(... )          do {} while (0)
+    #define LOG_EMIT_W(... )          do {} while (0)
+    #define LOG_EMIT_E(... )          do {} while (0)
+    #define LOG_EMIT_D(... )          do {} while (0)
+    #define LOG_EMIT_SIMPLE_I(... )   do {} while (0)
+    #define LOG_EMIT_SIMPLE_W(... )   do {} while (0)
+    #define LOG_EMIT_SIMPLE_E(... )   do {} while (0)
+    #define LOG_EMIT_SIMPLE_D(... )   do {} while (0)
+    #define LOG_DOT()                 do {} while (0)
+    #define LOG_FLUSH()               do {} while (0)
+
+#endif
+
+// Calls below the threshold: nothing is compiled (no format string in flash, arguments not evaluated)
+#define LOG_OFF(... )                 do {} while (0)
 
+// --------------------------------------------------------------------
+// Public macros: global threshold (LOG_LEVEL)
+// --------------------------------------------------------------------
+#if LOG_LEVEL >= LOG_LEVEL_ERROR
+    #define LOGE(... )          LOG_EMIT_E(__VA_ARGS__)
+    #define LOGE_SIMPLE(... )   LOG_EMIT_SIMPLE_E(__VA_ARGS__)
+#else
+    #define LOGE(... )          LOG_OFF()
+    #define LOGE_SIMPLE(... )   LOG_OFF()
+#endif
+
+#if LOG_LEVEL >= LOG_LEVEL_WARN
+    #define LOGW(... )          LOG_EMIT_W(__VA_ARGS__)
+    #define LOGW_SIMPLE(... )   LOG_EMIT_SIMPLE_W(__VA_ARGS__)
+#else
+    #define LOGW(... )          LOG_OFF()
+    #define LOGW_SIMPLE(... )   LOG_OFF()
+#endif
+
+#if LOG_LEVEL >= LOG_LEVEL_INFO
+    #define LOGI(... )          LOG_EMIT_I(__VA_ARGS__)
+    #define LOGI_SIMPLE(... )   LOG_EMIT_SIMPLE_I(__VA_ARGS__)
+#else
+    #define LOGI(... )          LOG_OFF()
+    #define LOGI_SIMPLE(... )   LOG_OFF()
+#endif
+
+#if LOG_LEVEL >= LOG_LEVEL_DEBUG
+    #define LOGD(... )          LOG_EMIT_D(__VA_ARGS__)
+    #define LOGD_SIMPLE(... )   LOG_EMIT_SIMPLE_D(__VA_ARGS__)
+#else
+    #define LOGD(... )          LOG_OFF()
+    #define LOGD_SIMPLE(... )   LOG_OFF()
+#endif
+
+// --------------------------------------------------------------------
+// Public macros: per-module thresholds (LOG<level>_<MODULE>)
+//   LUT    : data/lut_utils.h, LutTemperatureConverter (per-conversion search / interpolation traces)
+//   ADC    : AdcSampler, CorrectedAdcSampler, DualPullupAdcSampler, CicAdcSampler
+//   SENSOR : TemperatureSensor, TemperatureSensorT, SensorArray, resistance converters
+// A module threshold may be above LOG_LEVEL (debug one module in a release build).
+// --------------------------------------------------------------------
+#if LOG_LEVEL_LUT >= LOG_LEVEL_ERROR
+    #define LOGE_LUT(... )      LOG_EMIT_E(__VA_ARGS__)
+#else
+    #define LOGE_LUT(... )      LOG_OFF()
+#endif
+#if LOG_LEVEL_LUT >= LOG_LEVEL_WARN
+    #define LOGW_LUT(... )      LOG_EMIT_W(__VA_ARGS__)
+#else
+    #define LOGW_LUT(... )      LOG_OFF()
+#endif
+#if LOG_LEVEL_LUT >= LOG_LEVEL_INFO
+    #define LOGI_LUT(... )      LOG_EMIT_I(__VA_ARGS__)
+#else
+    #define LOGI_LUT(... )      LOG_OFF()
+#endif
+#if LOG_LEVEL_LUT >= LOG_LEVEL_DEBUG
+    #define LOGD_LUT(... )      LOG_EMIT_D(__VA_ARGS__)
+#else
+    #define LOGD_LUT(... )      LOG_OFF()
+#endif
+
+#if LOG_LEVEL_ADC >= LOG_LEVEL_ERROR
+    #define LOGE_ADC(... )      LOG_EMIT_E(__VA_ARGS__)
+#else
+    #define LOGE_ADC(... )      LOG_OFF()
+#endif
+#if LOG_LEVEL_ADC >= LOG_LEVEL_WARN
+    #define LOGW_ADC(... )      LOG_EMIT_W(__VA_ARGS__)
+#else
+    #define LOGW_ADC(... )      LOG_OFF()
+#endif
+#if LOG_LEVEL_ADC >= LOG_LEVEL_INFO
+    #define LOGI_ADC(... )      LOG_EMIT_I(__VA_ARGS__)
+#else
+    #define LOGI_ADC(... )      LOG_OFF()
+#endif
+#if LOG_LEVEL_ADC >= LOG_LEVEL_DEBUG
+    #define LOGD_ADC(... )      LOG_EMIT_D(__VA_ARGS__)
+#else
+    #define LOGD_ADC(... )      LOG_OFF()
+#endif
+
+#if LOG_LEVEL_SENSOR >= LOG_LEVEL_ERROR
+    #define LOGE_SENSOR(... )   LOG_EMIT_E(__VA_ARGS__)
+#else
+    #define LOGE_SENSOR(... )   LOG_OFF()
+#endif
+#if LOG_LEVEL_SENSOR >= LOG_LEVEL_WARN
+    #define LOGW_SENSOR(... )   LOG_EMIT_W(__VA_ARGS__)
+#else
+    #define LOGW_SENSOR(... )   LOG_OFF()
+#endif
+#if LOG_LEVEL_SENSOR >= LOG_LEVEL_INFO
+    #define LOGI_SENSOR(... )   LOG_EMIT_I(__VA_ARGS__)
+#else
+    #define LOGI_SENSOR(... )   LOG_OFF()
+#endif
+#if LOG_LEVEL_SENSOR >= LOG_LEVEL_DEBUG
+    #define LOGD_SENSOR(... )   LOG_EMIT_D(__VA_ARGS__)
+#else
+    #define LOGD_SENSOR(... )   LOG_OFF()
+#endif
+
+// Output start + lost messages counter (both modes)
+#if LOG_ENABLE && LOG_TX_RING
+    #define LOG_BEGIN(baud)     logger::tx::begin(baud)
+#elif LOG_ENABLE
+    #define LOG_BEGIN(baud)     do { Serial.begin(baud); while (!Serial) { delay(10); } } while (0)
+#else
+    #define LOG_BEGIN(baud)     do {} while (0)
+#endif
+
+#if LOG_ENABLE && LOG_TX_RING && LOG_BINARY
+    #define LOG_DROPPED()       static_cast<uint16_t>(logger::tx::dropped() + logger::binary::dropped())
+#elif LOG_ENABLE && LOG_TX_RING
+    #define LOG_DROPPED()       logger::tx::dropped()
+#elif LOG_ENABLE && LOG_BINARY
+    #define LOG_DROPPED()       logger::binary::dropped()
+#else
+    #define LOG_DROPPED()       static_cast<uint16_t>(0)
+#endif
+
+// True when a message of size bytes is accepted right now without being dropped (or evicting others)
+#if LOG_ENABLE && LOG_BINARY
+    #define LOG_FITS(size)      (logger::binary::room() >= (size))
+#elif LOG_ENABLE && LOG_TX_RING
+    #define LOG_FITS(size)      (logger::tx::room() >= (size))
+#else
+    #define LOG_FITS(size)      (static_cast<void>(size), true)     // Blocking Serial or logs off: nothing is dropped
 #endif
@@ -1,6 +1,9 @@
 #pragma once
 #include <stdint.h> // Include standard integer types for fixed-width types.
+#include <stddef.h> // size_t
+#if defined(ARDUINO)
 #include <Arduino.h>
+#endif
 
 
 /// @brief Namespace for AVR algorithms and utilities
@@ -2,6 +2,7 @@
 
 #include <stdint.h>
 #include <stddef.h>
+#include "utils/avr_algorithms.h"  // For for_each_element (average)
 
 namespace math
     {
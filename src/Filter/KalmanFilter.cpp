@@ -0,0 +1,161 @@
+#include "Filter/KalmanFilter.h"
+
+/**
+ * @brief Construct a new Kalman Filter:: Kalman Filter object
+ * 
+ * @param measurement_noise - R: reading noise variance in (0.1°C)^2
+ * @param process_noise - Q: level process noise variance per reading
+ * @param rate_noise - Q_rate: rate process noise variance per reading
+ * @param use_rate - true -> level + rate model (no ramp lag, overshoots steps)
+ */
+KalmanFilter::KalmanFilter(float measurement_noise, float process_noise, float rate_noise, bool use_rate):
+r_(measurement_noise),
+q_(process_noise),
+qRate_(rate_noise),
+p00_(0), p01_(0), p11_(0),
+level_(0),
+rate_(0),
+gainLevel_(0),
+gainRate_(0),
+useRate_(use_rate),
+seeded_(false),
+frozen_(false),
+steps_(0),
+stableSteps_(0),
+initialize_(false)
+{
+}
+
+/**
+ * @brief Final initialization: noise validation
+ * 
+ */
+void KalmanFilter::begin()
+{
+    if(initialize_) return;
+
+    if(r_ <= 0.0f)
+    {
+        LOGW("KalmanFilter:: Invalid measurement noise - using %d", (int)Filtering::KALMAN_MEASUREMENT_NOISE);
+        r_ = Filtering::KALMAN_MEASUREMENT_NOISE;
+    }
+
+    if(q_ <= 0.0f && (!useRate_ || qRate_ <= 0.0f))
+    {
+        LOGW("KalmanFilter:: Process noise is 0 - the filter would freeze, using defaults");
+        q_ = Filtering::KALMAN_PROCESS_NOISE;
+    }
+
+    initialize_ = true;
+}
+
+/**
+ * @brief Forget the state: the next apply() seeds the filter again
+ * 
+ */
+void KalmanFilter::reset()
+{
+    seeded_ = false;
+    frozen_ = false;
+}
+
+/**
+ * @brief Predict, then correct with the new reading
+ * 
+ * @details
+ *  1. Seed:     first reading -> level = z, rate = 0, P = diag(R, R)
+ *  2. Gains:    covariance recursion, only until the gains converged
+ *  3. Predict:  level += rate
+ *  4. Correct:  e = z - level;  level += K0 * e;  rate += K1 * e
+ * 
+ * @param new_value New reading (x10 °C).
+ * @return int16_t Filtered level (x10 °C).
+ */
+int16_t KalmanFilter::apply(int16_t new_value)
+{
+    const int32_t z = static_cast<int32_t>(new_value) * (static_cast<int32_t>(1) << FRAC_BITS);
+
+    // Step1: Seed from the first real input
+    if(!seeded_)
+    {
+        level_ = z;
+        rate_  = 0;
+        p00_   = r_;
+        p01_   = 0.0f;
+        p11_   = useRate_ ? r_ : 0.0f;
+        steps_ = 0;
+        stableSteps_ = 0;
+        seeded_ = true;
+        frozen_ = false;
+        return new_value;
+    }
+
+    // Step2: Gains (data independent, stops once converged)
+    if(!frozen_) updateGains();
+
+    // Step3: Predict
+    if(useRate_) level_ += rate_;
+
+    // Step4: Correct (innovation clamped to keep the split multiply in range)
+    constexpr int32_t E_MAX = (static_cast<int32_t>(1) << 23) - 1;
+    int32_t innovation = z - level_;
+    if(innovation >  E_MAX) innovation =  E_MAX;
+    if(innovation < -E_MAX) innovation = -E_MAX;
+
+    level_ += filter_utils::mulQ15(innovation, gainLevel_);
+    if(useRate_) rate_ += filter_utils::mulQ15(innovation, gainRate_);
+
+    return static_cast<int16_t>(filter_utils::roundedShift(level_, FRAC_BITS));
+}
+
+/**
+ * @brief One step of the covariance recursion
+ * 
+ * @details F = [[1,1],[0,1]] (or [1] without rate), H = [1, 0]
+ *  - Predict:  P00 += 2*P01 + P11 + Q;  P01 += P11;  P11 += Q_rate
+ *  - Gain:     S = P00 + R;  K0 = P00 / S;  K1 = P01 / S
+ *  - Update:   P11 -= K1 * P01;  P01 *= (1 - K0);  P00 *= (1 - K0)
+ *  Gains are frozen once neither changed by more than one Q15 LSB for STABLE_STEPS steps in a row
+ *  (or after 255 steps). The first steps can repeat the same gain, hence the streak.
+ */
+void KalmanFilter::updateGains()
+{
+    // Predict covariance
+    if(useRate_)
+    {
+        p00_ += 2.0f * p01_ + p11_ + q_;
+        p01_ += p11_;
+        p11_ += qRate_;
+    }
+    else
+    {
+        p00_ += q_;
+    }
+
+    // Gains
+    const float s  = p00_ + r_;
+    const float k0 = p00_ / s;
+    const float k1 = p01_ / s;
+
+    // Update covariance
+    p11_ -= k1 * p01_;
+    p01_ *= (1.0f - k0);
+    p00_ *= (1.0f - k0);
+
+    // Convert to Q15 and check convergence
+    const int32_t newLevel = static_cast<int32_t>(k0 * 32768.0f + 0.5f);
+    const int32_t newRate  = useRate_ ? static_cast<int32_t>(k1 * 32768.0f + (k1 < 0 ? -0.5f : 0.5f)) : 0;
+
+    const bool converged = (newLevel - gainLevel_ <= 1 && gainLevel_ - newLevel <= 1)
+                        && (newRate  - gainRate_  <= 1 && gainRate_  - newRate  <= 1);
+
+    gainLevel_ = newLevel;
+    gainRate_  = newRate;
+    stableSteps_ = converged ? static_cast<uint8_t>(stableSteps_ + 1) : 0;
+
+    if(stableSteps_ == STABLE_STEPS || ++steps_ == 255)
+    {
+        frozen_ = true;
+        LOGD("KalmanFilter:: gains frozen: K0 = %ld/32768, K1 = %ld/32768", (long)gainLevel_, (long)gainRate_);
+    }
+}
@@ -1,5 +1,9 @@
 #include "Model/AdcSampler.h"
 
+#include <avr/io.h>
+
+AdcSampler* AdcSampler::owner_ = nullptr;
+
 /**
  * @brief Construct a new Adc Sampler:: Adc Sampler object
  * 
@@ -13,6 +17,11 @@ pin_(adc_pin),
 samples_per_read_((samples_to_average > 0) ? samples_to_average : 1),
 discard_N_first_(samples_to_discard),
 settleUs_((settle_us > 0) ? settle_us : 10),
+accumulated_(0),
+conversionsLeft_(0),
+lastConversionUs_(0),
+pending_(false),
+converting_(false),
 initialize_(false)
 {
 }
@@ -20,7 +29,7 @@ initialize_(false)
 /**
  * @brief Final initialization: validation, pin setup
  * 
- * @note Call this after Serial.begin() in setup() to avoid side effects
+ * @note Call this after LOG_BEGIN() in setup() to avoid side effects
  */
 void AdcSampler::begin()
 {
@@ -29,14 +38,19 @@ void AdcSampler::begin()
 
     // Analog pin validation  
     if( pin_ > NUM_ANALOG_INPUTS )
-     LOGE("AdcSampler:: Invalid ADC pin: %d", pin_);
+     LOGE_ADC("AdcSampler:: Invalid ADC pin: %d", pin_);
     
     // Overflow protection
     if (samples_per_read_ > 64)
-     LOGW("AdcSampler:: samples_per_read_ overflow: %d", samples_per_read_);
+     LOGW_ADC("AdcSampler:: samples_per_read_ overflow: %d", samples_per_read_);
     
     // Configure ADC pin
     pinMode(pin_, INPUT);
+
+    // One throwaway conversion: programs the analogReference() bits in ADMUX (kept by the split-phase mode)
+    analogRead(pin_);
+
+    initialize_ = true;
 }
 
 /**
@@ -68,13 +82,113 @@ uint16_t AdcSampler::sample()
         if(settleUs_ > 0) delayMicroseconds(settleUs_);
     });
 
-    // Step3: average the accumulated samples (with rounding for non-power of 2)   
+    // Step3: average the accumulated samples 
+    return average(accumulated);
+}
+
+/**
+ * @brief Start a non-blocking acquisition
+ * 
+ * @details Only resets the state: the ADC is claimed by the first pollSample() that finds it free,
+ * so several samplers can be started together and run one after the other.
+ */
+void AdcSampler::startSample()
+{
+    // Restarting mid-acquisition: a conversion still running simply counts as the first one of the new acquisition
+    accumulated_     = 0;
+    conversionsLeft_ = static_cast<uint8_t>(discard_N_first_ + samples_per_read_);
+    pending_         = true;
+}
+
+/**
+ * @brief Advance the non-blocking acquisition by at most one conversion
+ * 
+ * @details
+ * - Waits (returns false) while another AdcSampler owns the ADC.
+ * - Conversion running      -> returns false until ADSC clears, then accumulates the result.
+ * - Conversion finished     -> starts the next one once settleUs_ elapsed.
+ * - Last conversion done    -> releases the ADC and returns the rounded average (same value as sample()).
+ * 
+ * @note Do not mix with analogRead()/sample() on any pin while an acquisition is pending.
+ * 
+ * @param adc_raw - Receives the averaged ADC value
+ * @return true when the acquisition is complete
+ */
+bool AdcSampler::pollSample(uint16_t& adc_raw)
+{
+    if(!pending_) return false;
+
+    // Step1: Claim the ADC
+    if(owner_ && owner_ != this) return false;
+    owner_ = this;
+
+    // Step2: Collect a finished conversion
+    if(converting_)
+    {
+        if(ADCSRA & _BV(ADSC)) return false;        // Still converting (~104 µs at the Arduino prescaler)
+
+        const uint16_t raw = ADC;
+        converting_ = false;
+        lastConversionUs_ = static_cast<uint16_t>(micros());
+
+        if(conversionsLeft_ <= samples_per_read_) accumulated_ += raw;     // Past the discarded ones
+        --conversionsLeft_;
+
+        if(conversionsLeft_ == 0)
+        {
+            pending_ = false;
+            owner_   = nullptr;
+            adc_raw  = average(accumulated_);
+            return true;
+        }
+        return false;
+    }
+
+    // Step3: Start the next conversion once the signal settled (first one right away)
+    const bool first = (conversionsLeft_ == discard_N_first_ + samples_per_read_);
+    if(!first && static_cast<uint16_t>(static_cast<uint16_t>(micros()) - lastConversionUs_) < settleUs_) return false;
+
+    const uint8_t channel = static_cast<uint8_t>((pin_ >= A0) ? (pin_ - A0) : pin_);
+    ADMUX  = static_cast<uint8_t>((ADMUX & 0xC0) | (channel & 0x07));     // Keep the reference, select the channel
+    ADCSRA |= _BV(ADSC);
+    converting_ = true;
+
+    return false;
+}
+
+/**
+ * @brief Abandon the pending acquisition and release the ADC
+ * 
+ * @details Without it an acquisition that is never polled again keeps owner_ set and every other
+ * AdcSampler waits forever. A conversion still running is let finish (~104 µs at most) so the next
+ * owner does not collect a result of this channel.
+ */
+void AdcSampler::cancelSample()
+{
+    if(owner_ == this)
+    {
+        if(converting_) while(ADCSRA & _BV(ADSC)) {}
+        owner_ = nullptr;
+    }
+
+    pending_    = false;
+    converting_ = false;
+}
+
+/**
+ * @brief Average the accumulated samples (with rounding for non-power of 2)
+ * 
+ * @param accumulated - Sum of samples_per_read_ conversions
+ * @return uint16_t - Average clamped to Adc::MAX_VALUE
+ */
+uint16_t AdcSampler::average(uint32_t accumulated) const noexcept
+{
     uint16_t avg = (samples_per_read_ == 1)
     ? static_cast<uint16_t>(accumulated)
     : static_cast<uint16_t>((accumulated + (samples_per_read_ >> 1)) / samples_per_read_); 
 
-    LOGD("AdcSampler:: ADC pin %d: raw avg = %d", pin_,avg);
+    LOGD_ADC("AdcSampler:: ADC pin %d: raw avg = %d", pin_,avg);
 
-    // Step4: Return the average value(Clamp if avg> 1023 max resolution) 
+    // Return the average value(Clamp if avg> 1023 max resolution) 
     return (avg > Adc::MAX_VALUE) ? Adc::MAX_VALUE : avg;
 }
@@ -0,0 +1,154 @@
+#include "Model/CicAdcSampler.h"
+
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include <util/atomic.h>
+
+CicAdcSampler* volatile CicAdcSampler::active_ = nullptr;
+
+/**
+ * @brief ADC conversion complete: forward the result to the active CIC sampler
+ * 
+ */
+ISR(ADC_vect)
+{
+    const uint16_t raw = ADC;       // ADCL then ADCH
+    CicAdcSampler* sampler = CicAdcSampler::active();
+    if(sampler) sampler->onConversion(raw);
+}
+
+/**
+ * @brief Construct a new Cic Adc Sampler:: Cic Adc Sampler object
+ * 
+ * @param adc_pin - Analog pin (A0..A7)
+ */
+CicAdcSampler::CicAdcSampler(uint8_t adc_pin):
+pin_(adc_pin),
+cic_(),
+latest_(0),
+fresh_(false),
+initialize_(false)
+{
+}
+
+/**
+ * @brief Final initialization: claims the ADC and starts free-running conversions
+ * 
+ * @note analogReference() only stores the mode: a throwaway analogRead() programs the reference bits in ADMUX
+ *       before the free-running setup keeps them (call analogReference() first when not using DEFAULT)
+ */
+void CicAdcSampler::begin()
+{
+    // Check if instance is already initialize
+    if(initialize_) return;
+
+    // Analog pin validation
+    if(pin_ < A0 || pin_ >= A0 + NUM_ANALOG_INPUTS)
+    {
+        LOGE_ADC("CicAdcSampler:: Invalid ADC pin: %d", pin_);
+        return;
+    }
+
+    if(active_ && active_ != this)
+    {
+        LOGE_ADC("CicAdcSampler:: ADC already owned by another CIC sampler");
+        return;
+    }
+
+    pinMode(pin_, INPUT);
+
+    // One throwaway conversion: programs the analogReference() bits (REFS stays 00 = external AREF until then)
+    analogRead(pin_);
+
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+    {
+        cic_.reset();
+        fresh_  = false;
+        active_ = this;
+
+        // Keep the reference selection, select the channel (right adjusted result)
+        ADMUX  = static_cast<uint8_t>((ADMUX & 0xC0) | ((pin_ - A0) & 0x07));
+        ADCSRB = 0;                                                                     // Free-running trigger
+        ADCSRA = _BV(ADEN) | _BV(ADATE) | _BV(ADIE) | _BV(ADPS2) | _BV(ADPS1) | _BV(ADPS0); // Enable, auto-trigger, IRQ, /128
+        ADCSRA |= _BV(ADSC);                                                            // First conversion starts the run
+    }
+
+    LOGD_ADC("CicAdcSampler:: free-running on pin %d, order %d, decimation %u", pin_, Adc::CIC_ORDER, Adc::CIC_DECIMATION);
+
+    initialize_ = true;
+}
+
+/**
+ * @brief Stops the free-running ADC and releases it
+ * 
+ */
+void CicAdcSampler::stop()
+{
+    if(active_ != this) return;
+
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+    {
+        ADCSRA = _BV(ADEN) | _BV(ADPS2) | _BV(ADPS1) | _BV(ADPS0);   // Back to the Arduino core setup (single conversion)
+        active_ = nullptr;
+    }
+
+    initialize_ = false;
+}
+
+/**
+ * @brief Latest decimated sample scaled back to ADC counts
+ * 
+ * @details
+ *  - Waits only for the first primed output after begin() (Order + 1 decimated periods, ~25 ms by default),
+ *    at most Adc::CIC_PRIME_TIMEOUT_MS: the ADC interrupt stops if ADCSRA is reconfigured (analogRead()).
+ *  - The 32-bit value is copied with interrupts disabled (the ISR writes it byte by byte on AVR).
+ *  - Normalization (÷ Ratio^Order, a shift by default) runs here, outside the ISR.
+ * 
+ * @return uint16_t raw ADC value, clamped to Adc::MAX_VALUE (Adc::INVALID_SAMPLE if not running or timed out)
+ */
+uint16_t CicAdcSampler::sample()
+{
+    if(active_ != this)
+    {
+        LOGE_ADC("CicAdcSampler:: sample() while not running");
+        return Adc::INVALID_SAMPLE;
+    }
+
+    // Only after begin(): the ISR primes the decimator within a few ms
+    const uint32_t startMs = millis();
+    while(!fresh_)
+    {
+        if(millis() - startMs >= Adc::CIC_PRIME_TIMEOUT_MS)
+        {
+            LOGE_ADC("CicAdcSampler:: no decimated output after %u ms (ADC interrupt stopped?)", Adc::CIC_PRIME_TIMEOUT_MS);
+            return Adc::INVALID_SAMPLE;
+        }
+    }
+
+    uint32_t output;
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+    {
+        output = latest_;
+    }
+
+    const uint32_t counts = Decimator::normalized(output);
+
+    LOGD_ADC("CicAdcSampler:: ADC pin %d: decimated = %lu", pin_, (unsigned long)counts);
+
+    return (counts > Adc::MAX_VALUE) ? Adc::MAX_VALUE : static_cast<uint16_t>(counts);
+}
+
+
+/**
+ * @brief Non-blocking variant of sample(): the ISR already acquires in the background
+ * 
+ * @param adc_raw - Receives the latest decimated sample
+ * @return false only while the decimator is priming after begin() (not running -> true, Adc::INVALID_SAMPLE)
+ */
+bool CicAdcSampler::pollSample(uint16_t& adc_raw)
+{
+    if(active_ == this && !fresh_) return false;
+
+    adc_raw = sample();
+    return true;
+}
@@ -0,0 +1,120 @@
+#include "Model/CorrectedAdcSampler.h"
+
+/**
+ * @brief Construct a new Corrected Adc Sampler:: Corrected Adc Sampler object
+ * 
+ * @param sampler - Sampler that provides the raw averaged ADC value
+ * @param correction_P - PROGMEM pointer to the correction curve
+ */
+CorrectedAdcSampler::CorrectedAdcSampler(ISampler* sampler, const int8_t* correction_P):
+sampler_(sampler),
+correction_P_(correction_P),
+initialize_(false)
+{
+}
+
+/**
+ * @brief Final initialization: validation
+ * 
+ * @note The wrapped sampler keeps its own begin(), call it as well (e.g. via initSubSystems)
+ */
+void CorrectedAdcSampler::begin()
+{
+    // Check if instance is already initialize
+    if(initialize_) return;
+
+    if(!sampler_)       LOGE_ADC("CorrectedAdcSampler:: No sampler to correct");
+    if(!correction_P_)  LOGW_ADC("CorrectedAdcSampler:: No correction curve - passing raw values through");
+
+    initialize_ = true;
+}
+
+/**
+ * @brief Sample through the wrapped sampler and apply the correction curve
+ * 
+ * @return uint16_t corrected ADC value
+ */
+uint16_t CorrectedAdcSampler::sample()
+{
+    if(!sampler_) return Adc::INVALID_SAMPLE;       // Configuration error, not a shorted probe
+
+    return correct(sampler_->sample());
+}
+
+/**
+ * @brief Start a non-blocking acquisition on the wrapped sampler
+ * 
+ */
+void CorrectedAdcSampler::startSample()
+{
+    if(sampler_) sampler_->startSample();
+}
+
+/**
+ * @brief Advance the wrapped acquisition and apply the correction curve once it completes
+ * 
+ * @param adc_raw - Receives the corrected ADC value
+ * @return true when adc_raw is valid
+ */
+bool CorrectedAdcSampler::pollSample(uint16_t& adc_raw)
+{
+    if(!sampler_)
+    {
+        adc_raw = Adc::INVALID_SAMPLE;              // Completes as NotConfigured
+        return true;
+    }
+
+    if(!sampler_->pollSample(adc_raw)) return false;
+
+    adc_raw = correct(adc_raw);
+    return true;
+}
+
+/**
+ * @brief Abandon the wrapped acquisition (releases the ADC it may hold)
+ * 
+ */
+void CorrectedAdcSampler::cancelSample()
+{
+    if(sampler_) sampler_->cancelSample();
+}
+
+/**
+ * @brief Correct a raw ADC code with the piecewise-linear curve
+ * 
+ * @details
+ *  - idx  = raw >> shift           -> left knot
+ *  - frac = raw & (2^shift - 1)    -> position inside the segment
+ *  - offset = c[idx] + ((c[idx+1] - c[idx]) * frac) / 2^shift   (rounded)
+ *  - Codes 0 and Adc::MAX_VALUE are kept as is: they are the open/short rails, not measurements to correct
+ *    (Adc::INVALID_SAMPLE passes through as well).
+ * 
+ * @param adc_raw - Raw ADC counts
+ * @return uint16_t - Corrected ADC counts clamped to 1..Adc::MAX_VALUE-1
+ */
+uint16_t CorrectedAdcSampler::correct(uint16_t adc_raw) const noexcept
+{
+    if(!correction_P_ || adc_raw == 0 || adc_raw >= Adc::MAX_VALUE) return adc_raw;
+
+    constexpr uint8_t  shift = Adc::CORRECTION_KNOT_SHIFT;
+    constexpr uint16_t mask  = (1u << shift) - 1u;
+
+    // Step1: Locate the segment
+    const uint8_t idx  = static_cast<uint8_t>(adc_raw >> shift);
+    const int16_t frac = static_cast<int16_t>(adc_raw & mask);
+
+    // Step2: Read both knots from flash
+    const int16_t c0 = static_cast<int8_t>(pgm_read_byte(correction_P_ + idx));
+    const int16_t c1 = static_cast<int8_t>(pgm_read_byte(correction_P_ + idx + 1));
+
+    // Step3: Interpolate the offset (|delta * frac| <= 255 * 63, fits int16_t) with rounding
+    const int16_t offset = static_cast<int16_t>(c0 + (((c1 - c0) * frac + (1 << (shift - 1))) >> shift));
+
+    // Step4: Apply and clamp inside the rails (a corrected measurement must never look like an open/short)
+    const int16_t corrected = static_cast<int16_t>(adc_raw) + offset;
+
+    if(corrected < 1)              return 1;
+    if(corrected >= Adc::MAX_VALUE) return Adc::MAX_VALUE - 1;
+
+    return static_cast<uint16_t>(corrected);
+}
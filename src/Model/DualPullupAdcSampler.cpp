@@ -0,0 +1,150 @@
+#include "Model/DualPullupAdcSampler.h"
+
+/**
+ * @brief Construct a new Dual Pullup Adc Sampler:: Dual Pullup Adc Sampler object
+ * 
+ * @param adc_pin - Adc pin connected to the divider junction
+ * @param switch_pin - GPIO connected to the switched pullup
+ * @param samples_to_average - Number of sample to average
+ * @param samples_to_discard - N first sample to discard
+ * @param settle_us - delay between sample to stabilization
+ */
+DualPullupAdcSampler::DualPullupAdcSampler(uint8_t adc_pin, uint8_t switch_pin, uint8_t samples_to_average, uint8_t samples_to_discard, uint8_t settle_us):
+adc_(adc_pin, samples_to_average, samples_to_discard, settle_us),
+switchPin_(switch_pin),
+range_(PullupRange::High),
+switched_(false),
+initialize_(false)
+{
+}
+
+/**
+ * @brief Final initialization: ADC pin setup and initial range
+ * 
+ * @note Call this after LOG_BEGIN() in setup() to avoid side effects
+ */
+void DualPullupAdcSampler::begin()
+{
+    // Check if instance is already initialize
+    if(initialize_) return;
+
+    adc_.begin();
+
+    // Start on the high range: an unknown probe is assumed cold (it also limits the current through the divider)
+    selectRange(PullupRange::High);
+
+    initialize_ = true;
+}
+
+/**
+ * @brief Sample the junction keeping it near mid-scale
+ * 
+ * @details
+ * - Samples with the current range.
+ * - High range and junction below Adc::RANGE_SWITCH_LOW_COUNTS  -> NTC is small, switch to Low and re-sample.
+ * - Low range and junction above Adc::RANGE_SWITCH_HIGH_COUNTS  -> NTC is big, switch to High and re-sample.
+ * - The AdcSampler discards its first N readings, which also covers the settling after the switch.
+ * 
+ * @return uint16_t raw average ADC value on range()
+ */
+uint16_t DualPullupAdcSampler::sample()
+{
+    // Step1: Sample with the current range
+    uint16_t raw = adc_.sample();
+
+    // Step2: Check if the junction left the window
+    if(!outOfWindow(raw)) return raw;
+
+    // Step3: Swap range and re-sample (only happens on range transitions)
+    selectRange((range_ == PullupRange::High) ? PullupRange::Low : PullupRange::High);
+    raw = adc_.sample();
+
+    LOGD_ADC("DualPullupAdcSampler:: switched to %s range, raw = %u", (range_ == PullupRange::Low) ? "low" : "high", raw);
+
+    return raw;
+}
+
+/**
+ * @brief Start a non-blocking acquisition on the current range
+ * 
+ */
+void DualPullupAdcSampler::startSample()
+{
+    switched_ = false;
+    adc_.startSample();
+}
+
+/**
+ * @brief Advance the acquisition (same range logic as sample())
+ * 
+ * @details When the first result falls outside the window the range is swapped and the acquisition
+ * restarted once, the caller keeps polling.
+ * 
+ * @param adc_raw - Receives the ADC value measured with range()
+ * @return true when adc_raw is valid
+ */
+bool DualPullupAdcSampler::pollSample(uint16_t& adc_raw)
+{
+    if(!adc_.pollSample(adc_raw)) return false;
+
+    if(switched_ || !outOfWindow(adc_raw)) return true;
+
+    selectRange((range_ == PullupRange::High) ? PullupRange::Low : PullupRange::High);
+    switched_ = true;
+    adc_.startSample();
+
+    LOGD_ADC("DualPullupAdcSampler:: switched to %s range, re-sampling", (range_ == PullupRange::Low) ? "low" : "high");
+
+    return false;
+}
+
+/**
+ * @brief Abandon the pending acquisition and release the ADC
+ * 
+ */
+void DualPullupAdcSampler::cancelSample()
+{
+    switched_ = false;
+    adc_.cancelSample();
+}
+
+/**
+ * @brief Check if the junction left the window of the current range
+ * 
+ * - High range and junction below Adc::RANGE_SWITCH_LOW_COUNTS  -> NTC is small, Low range needed.
+ * - Low range and junction above Adc::RANGE_SWITCH_HIGH_COUNTS  -> NTC is big, High range needed.
+ * 
+ * @param raw - ADC value measured on range_
+ * @return true when a range swap is needed
+ */
+bool DualPullupAdcSampler::outOfWindow(uint16_t raw) const noexcept
+{
+    if(raw == Adc::INVALID_SAMPLE) return false;    // Nothing acquired: swapping would not help
+
+    return ((range_ == PullupRange::High) && (raw < Adc::RANGE_SWITCH_LOW_COUNTS))
+        || ((range_ == PullupRange::Low)  && (raw > Adc::RANGE_SWITCH_HIGH_COUNTS));
+}
+
+/**
+ * @brief Drive the switch GPIO for the requested range
+ * 
+ * @note Low drives the pin HIGH (switched pullup in parallel), High leaves it as INPUT (Hi-Z).
+ *       Never drive it LOW: it would turn the switched resistor into a pulldown.
+ * 
+ * @param range - Range to apply
+ */
+void DualPullupAdcSampler::selectRange(PullupRange range)
+{
+    if(range == PullupRange::Low)
+    {
+        digitalWrite(switchPin_, HIGH);
+        pinMode(switchPin_, OUTPUT);
+    }
+    else
+    {
+        pinMode(switchPin_, INPUT);
+        digitalWrite(switchPin_, LOW);  // Make sure the internal pullup stays disabled
+    }
+
+    range_ = range;
+}
@@ -17,7 +17,7 @@ void LutTemperatureConverter::begin()
 {
     if(initialize_)return;
 
-    LOGD("LutTemperatureConverter:: Initializing...");
+    LOGD_LUT("LutTemperatureConverter:: Initializing...");
 }
 
 /**
@@ -41,15 +41,18 @@ void LutTemperatureConverter::begin()
 
 * - noexcept: Pure computation- no failure possible  
 * @param resistance_x10 Resistance in tenths of Ohms (e.g., 10000 = 1000.0 Ohms)
-* @return int32_t Temperature in tenths of degrees Celsius (e.g., 250 = 25.0 °C)
+* @return TemperatureResult Temperature in tenths of degrees Celsius (e.g., 250 = 25.0 °C) + status:
+*   Ok, BelowTable/AboveTable (clamped to the table edge) or ConversionError
 */
-int16_t LutTemperatureConverter::convertToTemperature_x10(uint32_t resistance_x10) const noexcept
+TemperatureResult LutTemperatureConverter::convertToTemperature(uint32_t resistance_x10) const noexcept
 {
+    TemperatureResult result;
+
     //Validate input resistance 
     if(resistance_x10 == 0)
     {
-        LOGE("LutTemperatureConverter::convertToTemperature_x10: Invalid resistance value 0");
-        return -32768; // Sentinel error code
+        LOGE_LUT("LutTemperatureConverter::convertToTemperature: Invalid resistance value 0");
+        return result; // ConversionError
     }
 
     // Step 1: Perform binary search to find bracketing entries
@@ -64,7 +67,7 @@ int16_t LutTemperatureConverter::convertToTemperature_x10(uint32_t resistance_x1
     // Step2: Handle bracketing results Edge cases
     if(bracket.outOfRange)
     {
-        LOGD("LutTemperatureConverter:: Resistance %u is out of LUT range",resistance_x10);
+        LOGD_LUT("LutTemperatureConverter:: Resistance %u is out of LUT range",resistance_x10);
         
         // Clamp to nearest valid temperature
         if(bracket.clamped)
@@ -72,42 +75,61 @@ int16_t LutTemperatureConverter::convertToTemperature_x10(uint32_t resistance_x1
             if(resistance_x10 > NTC_LUT[0].resistance_x10)
             {
                 // Above max resistance (colder than -40.0°C)
-                return NTC_LUT[0].temperature_x10;
+                result.value_x10 = NTC_LUT[0].temperature_x10;
+                result.status = ReadingStatus::BelowTable;
             }
             else
             {
                 // Below min resistance (hotter than +40.0°C)
-                return NTC_LUT[NTC_LUT_SIZE - 1].temperature_x10;
+                result.value_x10 = NTC_LUT[NTC_LUT_SIZE - 1].temperature_x10;
+                result.status = ReadingStatus::AboveTable;
             }
+            return result;
         }
 
         // Should not reach here
-        LOGE("LutTemperatureConverter:: Unexpected outOfRange state");
-        return -32768; // Sentinel error code
+        LOGE_LUT("LutTemperatureConverter:: Unexpected outOfRange state");
+        return result; // ConversionError
     }
 
     // Exact found
     if(bracket.foundExact)
     {
-        LOGD("LutTemperatureConverter:: Exact match found at index %zu", bracket.exactIdx);
-        return NTC_LUT[bracket.exactIdx].temperature_x10;
+        LOGD_LUT("LutTemperatureConverter:: Exact match found at index %zu", bracket.exactIdx);
+        result.value_x10 = NTC_LUT[bracket.exactIdx].temperature_x10;
+        result.status = ReadingStatus::Ok;
+        return result;
     }
 
     // Step3: Perform linear interpolation between the two bracketing entries
     const ThermistorEntry& cold = NTC_LUT[bracket.lowerIdx];
     const ThermistorEntry& hot = NTC_LUT[bracket.upperIdx];
 
-    LOGD("LutTemperatureConverter:: Applying linear interpolation for Resistance %lu between [%d Ω @ %d °C] and [%d Ω @ %d °C]",
+    LOGD_LUT("LutTemperatureConverter:: Applying linear interpolation for Resistance %lu between [%d Ω @ %d °C] and [%d Ω @ %d °C]",
         (unsigned long)resistance_x10,
         (int)cold.resistance_x10, (int)cold.temperature_x10,
         (int)hot.resistance_x10, (int)hot.temperature_x10
     );
 
-    return applyLinearInterpolation(
+    result.value_x10 = applyLinearInterpolation(
         resistance_x10,
         cold.resistance_x10,
         hot.resistance_x10,
         cold.temperature_x10,
         hot.temperature_x10
     );
-}
\ No newline at end of file
+    result.status = ReadingStatus::Ok;
+    return result;
+}
+
+/**
+ * @brief Convert resistance to temperature (sentinel interface)
+ * 
+ * @param resistance_x10 Resistance in tenths of Ohms (e.g., 10000 = 1000.0 Ohms)
+ * @return int16_t Temperature in tenths of degrees Celsius, clamped to the table edges, -32768 on error
+ */
+int16_t LutTemperatureConverter::convertToTemperature_x10(uint32_t resistance_x10) const noexcept
+{
+    const TemperatureResult result = convertToTemperature(resistance_x10);
+    return result.hasValue() ? result.value_x10 : Sensors::INVALID_READING_X10;
+}
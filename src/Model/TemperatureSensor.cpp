@@ -9,7 +9,18 @@ TemperatureSensor::TemperatureSensor():
     resistanceConverter_(nullptr),
     temperatureConverter_(nullptr),
     filter_(nullptr),
-    unit_(TemperatureUnit::Celsius)
+    unit_(TemperatureUnit::Celsius),
+    result_(),
+    requestedAtMs_(0),
+    pending_(false),
+    callback_(nullptr),
+    callbackContext_(nullptr),
+    deadbandX10_(0),
+    maxSilenceMs_(0),
+    notifiedX10_(0),
+    notifiedStatus_(ReadingStatus::NotConfigured),
+    notifiedAtMs_(0),
+    notified_(false)
 {
 }
 
@@ -21,6 +32,7 @@ TemperatureSensor::TemperatureSensor():
  */
 TemperatureSensor& TemperatureSensor::addSampler(ISampler* sampler)
 {
+    if(sampler != sampler_) cancelReading();    // The old sampler would keep the ADC
     this->sampler_ = sampler;
     return *this;
 }
@@ -75,6 +87,32 @@ TemperatureSensor& TemperatureSensor::setUnits(TemperatureUnit unit)
     return *this;
 }
 
+/**
+ * @brief Fluent change notification setter
+ * 
+ * @details The callback runs from read()/poll() (the caller's context, never from an ISR; the one-off
+ * readTemperature*() helpers never notify) when:
+ *  - it is the first reading after onChange(),
+ *  - the filtered value moved more than deadband_x10 from the last notified one,
+ *  - the status changed (e.g. Ok -> OpenCircuit),
+ *  - or max_silence_ms elapsed since the last notification (heartbeat, 0 disables it).
+ * 
+ * @param callback - Function to call (nullptr disables notifications)
+ * @param context - User pointer passed back to the callback
+ * @param deadband_x10 - Minimum move in 0.1°C (negative values are treated as 0)
+ * @param max_silence_ms - Maximum time without notification
+ * @return TemperatureSensor& - *this for method chaining 
+ */
+TemperatureSensor& TemperatureSensor::onChange(ReadingCallback callback, void* context, int16_t deadband_x10, uint32_t max_silence_ms)
+{
+    this->callback_ = callback;
+    this->callbackContext_ = context;
+    this->deadbandX10_ = (deadband_x10 < 0) ? 0 : deadband_x10;
+    this->maxSilenceMs_ = max_silence_ms;
+    this->notified_ = false;
+    return *this;
+}
+
 /**
  * @brief Finalize the TemperatureSensor configuration
  * 
@@ -85,7 +123,7 @@ TemperatureSensor& TemperatureSensor::build()
     // Here we could add validation to ensure all components are set
     // For simplicity, we assume the user configures everything correctly
 
-    LOGI("TemperatureSensor built with configuration: Sampler=%p, ResistanceConverter=%p, TemperatureConverter=%p, Filter=%p, Unit=%d",
+    LOGI_SENSOR("TemperatureSensor built with configuration: Sampler=%p, ResistanceConverter=%p, TemperatureConverter=%p, Filter=%p, Unit=%d",
         static_cast<void*>(sampler_),
         static_cast<void*>(resistanceConverter_),
         static_cast<void*>(temperatureConverter_),
@@ -97,151 +135,276 @@ TemperatureSensor& TemperatureSensor::build()
 }
 
 /**
- * @brief Read temperature as fixed point in tenths of degrees (0.1°C resolution)
+ * @brief Run one acquisition through the whole pipeline and keep every intermediate value
+ * 
+ * @details The ADC is sampled once and the filter (if any) steps once, whatever the caller reads
+ * from the returned snapshot afterwards. This is the blocking acquisition path: like poll(), it
+ * fires the onChange() notification.
  * 
- * @return int16_t - Temperature in tenths of degrees (e.g., 250 = 25.0 °C)
+ * @return Reading - Snapshot of the acquisition (status tells which stage failed, if any)
  */
-int16_t TemperatureSensor::readTemperature_x10() const noexcept
+Reading TemperatureSensor::read() noexcept
 {
+    const Reading reading = acquire();
+    notify(reading);
+    return reading;
+}
+
+/**
+ * @brief One acquisition through the whole pipeline, without notification
+ * 
+ * @return Reading - Snapshot of the acquisition (status tells which stage failed, if any)
+ */
+Reading TemperatureSensor::acquire() const noexcept
+{
+    Reading reading;
+
     // validate components
     if(!sampler_ || !resistanceConverter_ || !temperatureConverter_)
     {
-        LOGE("TemperatureSensor::readTemperature_x10: Sensor not properly configured");
-        return -32768; // Sentinel error code
+        LOGE_SENSOR("TemperatureSensor::read: Sensor not properly configured");
+        return reading; // status = NotConfigured
     } 
 
     // Step1: Sample raw ADC value
-    uint16_t adc_raw = sampler_->sample();
-    LOGD("TemperatureSensor::readTemperature_x10: Sampled ADC raw value: %d", adc_raw);
+    reading.timestamp_ms = millis();
+    reading.adc_raw = sampler_->sample();
+    LOGD_SENSOR("TemperatureSensor::read: Sampled ADC raw value: %d", reading.adc_raw);
 
-    // Step2: Convert ADC raw to Resistance (0.1Ω resolution)
-    uint32_t resistance_x10 = resistanceConverter_->convertToResistance_x10(adc_raw);
-    LOGD("TemperatureSensor::readTemperature_x10: Converted Resistance x10: %lu", (unsigned long)resistance_x10);
+    convert(reading);
+    return reading;
+}
+
+/**
+ * @brief Steps 2..5 of the pipeline on a sampled reading
+ * 
+ * @details Fault classification runs on the raw counts before any conversion. Clamped temperatures
+ * (BelowTable/AboveTable) still go through the filter, so the output follows the probe to the table edge.
+ * 
+ * @param reading - Snapshot with adc_raw set, completed in place (status tells which stage failed, if any)
+ */
+void TemperatureSensor::convert(Reading& reading) const noexcept
+{
+    // Step2: Classify the raw counts first: open/short NTC never reach a division or the LUT
+    reading.status = classifyAdc(reading.adc_raw);
+    if(reading.status == ReadingStatus::NotConfigured)
+    {
+        LOGE_SENSOR("TemperatureSensor::convert: Sampler could not acquire (not running / misconfigured)");
+        return;
+    }
+    if(reading.status != ReadingStatus::Ok)
+    {
+        LOGW_SENSOR("TemperatureSensor::convert: %s circuit (ADC raw %u)", (reading.status == ReadingStatus::OpenCircuit) ? "Open" : "Short", reading.adc_raw);
+        return;
+    }
+
+    // Step3: Convert ADC raw to Resistance (0.1Ω resolution)
+    reading.resistance_x10 = resistanceConverter_->convertToResistance_x10(reading.adc_raw);
+    LOGD_SENSOR("TemperatureSensor::convert: Converted Resistance x10: %lu", (unsigned long)reading.resistance_x10);
 
         // Validate resistance
-        if(resistance_x10 == 0)
+        if(reading.resistance_x10 == 0)
         {
-            LOGE("TemperatureSensor::readTemperature_x10: Invalid resistance value 0");
-            return -32768; // Sentinel error code
+            LOGE_SENSOR("TemperatureSensor::convert: Invalid resistance value 0");
+            reading.status = ReadingStatus::ConversionError;
+            return;
         }
 
-    // Step3: Convert Resistance to Temperature (0.1°C resolution)
-    int16_t temperature_x10 = temperatureConverter_->convertToTemperature_x10(resistance_x10);
-    LOGD("TemperatureSensor::readTemperature_x10: Converted Temperature x10 (Celsius): %d", (int)temperature_x10);
+    // Step4: Convert Resistance to Temperature (0.1°C resolution), keeping whether the table clamped it
+    const TemperatureResult temperature = temperatureConverter_->convertToTemperature(reading.resistance_x10);
+    reading.status = temperature.status;
+    LOGD_SENSOR("TemperatureSensor::convert: Converted Temperature x10 (Celsius): %d, status %d", (int)temperature.value_x10, (int)temperature.status);
 
         // Validate temperature
-        if (temperature_x10 == -32768)
+        if(!temperature.hasValue())
         {
-            LOGE("TemperatureSensor::readTemperature_x10: Invalid temperature value from converter");
-            return -32768; // Sentinel error code
+            LOGE_SENSOR("TemperatureSensor::convert: Invalid temperature value from converter");
+            return;
         }
+    reading.unfiltered_x10 = temperature.value_x10;
+
+    // Step5: Apply filter if configured
+    reading.temperature_x10 = (filter_) ? filter_->applyAt(reading.unfiltered_x10, reading.timestamp_ms) : reading.unfiltered_x10;
+    LOGD_SENSOR("TemperatureSensor::convert: Filtered Temperature x10: %d", reading.temperature_x10);
+}
 
-    // Step4: Apply filter if configured
-    if(filter_)
+/**
+ * @brief Fire the change notification when the reading is worth reporting
+ * 
+ * @details Integer compares only: the callback (and whatever formatting it does) is skipped while the
+ * filtered value stays inside the deadband of the last notified one.
+ * 
+ * @param reading - Completed reading
+ */
+void TemperatureSensor::notify(const Reading& reading) noexcept
+{
+    if(!callback_) return;
+
+    bool fire = !notified_ || (reading.status != notifiedStatus_);
+
+    if(!fire && reading.hasValue())
     {
-        temperature_x10 = filter_->apply(temperature_x10);
-        LOGD("TemperatureSensor::readTemperature_x10: Filtered Temperature x10: %d", temperature_x10);
+        const int16_t delta = static_cast<int16_t>(reading.temperature_x10 - notifiedX10_);
+        fire = (delta > deadbandX10_) || (delta < -deadbandX10_);
     }
 
-    return temperature_x10;
+    if(!fire && maxSilenceMs_ != 0) fire = (reading.timestamp_ms - notifiedAtMs_) >= maxSilenceMs_;
+
+    if(!fire) return;
+
+    notified_ = true;
+    notifiedStatus_ = reading.status;
+    notifiedX10_ = reading.temperature_x10;
+    notifiedAtMs_ = reading.timestamp_ms;
+
+    callback_(reading, callbackContext_);
 }
 
+/**
+ * @brief Split-phase acquisition, step 1: start sampling and return immediately
+ * 
+ * @details The conversion and filter steps run later, in the poll() that sees the samples ready.
+ * Requesting while an acquisition is pending restarts it.
+ * 
+ * @return true  - Acquisition started
+ * @return false - Sensor not properly configured
+ */
+bool TemperatureSensor::requestReading() noexcept
+{
+    if(!sampler_ || !resistanceConverter_ || !temperatureConverter_)
+    {
+        LOGE_SENSOR("TemperatureSensor::requestReading: Sensor not properly configured");
+        result_ = Reading();    // status = NotConfigured
+        return false;
+    }
 
-/// --- Helper methods to read temperature in different units ---
+    requestedAtMs_ = millis();
+    sampler_->startSample();
+    pending_ = true;
+    return true;
+}
 
 /**
- * @brief read temperature as a float in the selected unit
+ * @brief Split-phase acquisition, step 2: advance without blocking
  * 
- * @return float - Temperature in the selected unit (Celsius, Fahrenheit, Kelvin)
+ * @details Call it from loop() as often as possible. Once the sampler completes, the reading is
+ * converted and filtered (exactly once) and published through result().
+ * 
+ * @return true  - A new result() is ready (returned once per request)
+ * @return false - Nothing pending, or still sampling
  */
-float TemperatureSensor::readTemperature() const noexcept
+bool TemperatureSensor::poll() noexcept
 {
-    // Read temperature as fixed point scaled by 10
-    int16_t temp_x10 = readTemperature_x10();
+    if(!pending_) return false;
 
-    // Check if is valid
-    if(temp_x10 == -32768) return -999.9; // Sentinel invalid value
+    uint16_t adc_raw = 0;
+    if(!sampler_->pollSample(adc_raw)) return false;
 
-   
-    // Convert to celsius by default
-    float temp_c = static_cast<float>(temp_x10) / 10.0f;
+    pending_ = false;
 
+    Reading reading;
+    reading.timestamp_ms = requestedAtMs_;
+    reading.adc_raw = adc_raw;
+    convert(reading);
 
-    // Convert to desired unit
-    return (unit_ == TemperatureUnit::Celsius) ? temp_c :
-           (unit_ == TemperatureUnit::Fahrenheit) ? (temp_c * 9.0f / 5.0f + 32.0f) :
-           (unit_ == TemperatureUnit::Kelvin) ? (temp_c + 273.15f) :
-           temp_c; // Fallback to Celsius
+    result_ = reading;
+    notify(result_);
+    return true;
 }
 
 /**
- * @brief read temperature in Celsius as float
- *  without modify the unit selected 
+ * @brief Drop the pending split-phase acquisition
  * 
- * @return float - Temperature in Celsius
+ * @details Call it when a requested reading will not be polled any more: the sampler releases the
+ * ADC, so the other sensors' acquisitions can run. No result() is published.
  */
-float TemperatureSensor::readTemperatureC() noexcept
+void TemperatureSensor::cancelReading() noexcept
 {
-    // 1.Store temporally the previous unit
-    TemperatureUnit prev_unit = unit_;
+    if(!pending_) return;
 
-    // 2.Set unit to Celsius for this read
-    unit_ = TemperatureUnit::Celsius;
-    
-    // 3.Read temperature
-    float temp_c = readTemperature();
-    
-    // 4.Restore previous unit
-    unit_ = prev_unit;
+    pending_ = false;
+    if(sampler_) sampler_->cancelSample();
+}
 
-    // 5.Return temperature in Celsius
-    return temp_c;
+/**
+ * @brief Read temperature as fixed point in tenths of degrees (0.1°C resolution)
+ * 
+ * @return int16_t - Temperature in tenths of degrees (e.g., 250 = 25.0 °C), -32768 on error
+ */
+int16_t TemperatureSensor::readTemperature_x10() const noexcept
+{
+    return acquire().temperature_x10;  // INVALID_READING_X10 unless the reading has a value (Ok or clamped)
 }
 
 /**
- * @brief read temperature in Fahrenheit as float
- *  without modify the unit selected 
+ * @brief Read temperature in tenths of the given unit from one acquisition (integer multiply/shift, no float)
  * 
- * @return float - Temperature in Fahrenheit
+ * @param unit - TemperatureUnit enum value {Celsius, Fahrenheit, Kelvin}
+ * @return int16_t - Temperature in tenths of the unit (e.g., 770 = 77.0 °F), -32768 on error
  */
-float TemperatureSensor::readTemperatureF() noexcept
+int16_t TemperatureSensor::readTemperature_x10(TemperatureUnit unit) const noexcept
 {
-    // 1.Store temporally the previous unit
-    TemperatureUnit prev_unit = unit_;
+    return acquire().temperature_x10_in(unit);
+}
 
-    // 2.Set unit to Fahrenheit for this read
-    unit_ = TemperatureUnit::Fahrenheit;
-    
-    // 3.Read temperature
-    float temp_f = readTemperature();
-    
-    // 4.Restore previous unit
-    unit_ = prev_unit;
+/**
+ * @brief Check if the filtered output has converged
+ * 
+ * @details Filters seed from their first reading, so values are usable right away; this reports
+ * whether the optional warm-up is over (e.g. to hold back control decisions for the first few readings).
+ * 
+ * @return true  - No filter configured, or the filter is settled
+ * @return false - The filter is still warming up (or has not seen a reading yet)
+ */
+bool TemperatureSensor::isSettled() const noexcept
+{
+    return (filter_) ? filter_->isSettled() : true;
+}
+
+
+/// --- Helper methods to read temperature in different units ---
+
+/**
+ * @brief read temperature as a float in the selected unit
+ * 
+ * @return float - Temperature in the selected unit (Celsius, Fahrenheit, Kelvin)
+ */
+float TemperatureSensor::readTemperature() const noexcept
+{
+    // One acquisition, converted to the selected unit (-999.9 when invalid)
+    const Reading reading = acquire();
 
-    // 5.Return temperature in Fahrenheit
-    return temp_f;
+    return (unit_ == TemperatureUnit::Fahrenheit) ? reading.fahrenheit() :
+           (unit_ == TemperatureUnit::Kelvin) ? reading.kelvin() :
+           reading.celsius(); // Celsius and fallback
 }
 
 /**
- * @brief read temperature in Kelvin as float
- *  without modify the unit selected 
+ * @brief read temperature in Celsius as float, without touching the selected unit (reentrant)
  * 
- * @return float - Temperature in Kelvin
+ * @return float - Temperature in Celsius (-999.9 when invalid)
  */
-float TemperatureSensor::readTemperatureK() noexcept
+float TemperatureSensor::readTemperatureC() const noexcept
 {
-    // 1.Store temporally the previous unit
-    TemperatureUnit prev_unit = unit_;
+    return acquire().celsius();
+}
 
-    // 2.Set unit to Kelvin for this read
-    unit_ = TemperatureUnit::Kelvin;
-    
-    // 3.Read temperature
-    float temp_k = readTemperature();
-    
-    // 4.Restore previous unit
-    unit_ = prev_unit;
+/**
+ * @brief read temperature in Fahrenheit as float, without touching the selected unit (reentrant)
+ * 
+ * @return float - Temperature in Fahrenheit (-999.9 when invalid)
+ */
+float TemperatureSensor::readTemperatureF() const noexcept
+{
+    return acquire().fahrenheit();
+}
 
-    // 5.Return temperature in Kelvin
-    return temp_k;
-}
\ No newline at end of file
+/**
+ * @brief read temperature in Kelvin as float, without touching the selected unit (reentrant)
+ * 
+ * @return float - Temperature in Kelvin (-999.9 when invalid)
+ */
+float TemperatureSensor::readTemperatureK() const noexcept
+{
+    return acquire().kelvin();
+}
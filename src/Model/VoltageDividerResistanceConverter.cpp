@@ -1,4 +1,5 @@
 #include "Model/VoltageDividerResistanceConverter.h"
+#include "Model/DualPullupAdcSampler.h"
 
 
 /**
@@ -6,8 +7,29 @@
  * 
  * @param pullup_Ohms - Fixed resistance connected to V_REF
  */
-VoltageDividerResistanceConverter::VoltageDividerResistanceConverter(uint16_t pullup_Ohms):
+VoltageDividerResistanceConverter::VoltageDividerResistanceConverter(uint32_t pullup_Ohms):
 fixedResistor_(pullup_Ohms == 0 ? Sensors::PULLUP_FIXED_RESISTOR_OHMS : pullup_Ohms),
+lowRangeResistor_(0),
+rangeSource_(nullptr),
+initialize_(false)
+{}
+
+/**
+ * @brief Constructor for the auto-ranging (dual pullup) divider
+ * 
+ * @details The Low range pullup is the parallel of both resistors, computed once here (rounded):
+ *      R_low = (R_fixed * R_switched) / (R_fixed + R_switched)
+ * 
+ * @param pullup_Ohms - Fixed resistance permanently connected to V_REF
+ * @param switched_pullup_Ohms - Resistance driven by the range GPIO
+ * @param rangeSource - Sampler that reports the range used for each sample
+ */
+VoltageDividerResistanceConverter::VoltageDividerResistanceConverter(uint32_t pullup_Ohms, uint32_t switched_pullup_Ohms, const DualPullupAdcSampler* rangeSource):
+fixedResistor_(pullup_Ohms == 0 ? Sensors::PULLUP_HIGH_RANGE_OHMS : pullup_Ohms),
+lowRangeResistor_(static_cast<uint32_t>(
+    (static_cast<uint64_t>(fixedResistor_) * switched_pullup_Ohms + ((fixedResistor_ + switched_pullup_Ohms) >> 1))
+    / ((fixedResistor_ + switched_pullup_Ohms) ? (fixedResistor_ + switched_pullup_Ohms) : 1))),
+rangeSource_(rangeSource),
 initialize_(false)
 {}
 
@@ -15,7 +37,7 @@ initialize_(false)
 /**
  * @brief Final validation: Fixed resistance validation
  * 
- * @note call  this after Serial.begin() in setup() 
+ * @note call  this after LOG_BEGIN() in setup() 
  * 
  */
 void VoltageDividerResistanceConverter::begin()
@@ -25,7 +47,11 @@ void VoltageDividerResistanceConverter::begin()
 
     // Validate input pullup resistor value
     if (fixedResistor_ == 0)
-    LOGE("Invalid pullup fixed resistor value: 0Ohms- setting to default  %u" , Sensors::PULLUP_FIXED_RESISTOR_OHMS);
+    LOGE_SENSOR("Invalid pullup fixed resistor value: 0Ohms- setting to default  %u" , Sensors::PULLUP_FIXED_RESISTOR_OHMS);
+
+    // Validate the auto-ranging configuration
+    if (rangeSource_ && lowRangeResistor_ == 0)
+    LOGE_SENSOR("VoltageDividerResistanceConverter:: Invalid switched pullup value: 0Ohms- auto-ranging disabled");
 }
 
 /**
@@ -49,13 +75,27 @@ void VoltageDividerResistanceConverter::begin()
  */
 uint32_t VoltageDividerResistanceConverter::convertToResistance_x10(uint16_t adc_raw)
 {
-    // Step1: Validate adc_raw
-    if(adc_raw == 0 || adc_raw > Adc::MAX_VALUE)
+    // Step1: Validate adc_raw (MAX_VALUE -> open NTC, zero denominator)
+    if(adc_raw == 0 || adc_raw >= Adc::MAX_VALUE)
     {
-        LOGD("VoltageDividerResistanceConverter:: Invalid ADC raw value");
+        LOGD_SENSOR("VoltageDividerResistanceConverter:: Invalid ADC raw value");
         return 0;
     }
 
     // Step2: Apply voltage divider formula to compute NTC resistance scaled by 10
-    return (static_cast<uint32_t>(adc_raw) * fixedResistor_ * 10) / (Adc::MAX_VALUE - adc_raw);
+    return (static_cast<uint32_t>(adc_raw) * effectivePullup() * 10) / (Adc::MAX_VALUE - adc_raw);
+}
+
+/**
+ * @brief Pullup to apply for the current sample
+ * 
+ * @note adc_raw * pullup * 10 stays below 2^32 for pullups up to ~420KΩ
+ * 
+ * @return uint32_t - Effective pullup in Ohms
+ */
+uint32_t VoltageDividerResistanceConverter::effectivePullup() const noexcept
+{
+    if(rangeSource_ && lowRangeResistor_ && rangeSource_->range() == PullupRange::Low) return lowRangeResistor_;
+
+    return fixedResistor_;
 }
\ No newline at end of file
@@ -0,0 +1,189 @@
+#include "logger/Logger.h"
+
+#if defined(ARDUINO) && LOG_ENABLE && LOG_TX_RING
+
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include <util/atomic.h>
+
+namespace
+{
+    // Ring of messages: [length][bytes...][length][bytes...] (the length bytes are not sent)
+    uint8_t ring_[LOG_TX_RING_SIZE];
+    uint16_t head_ = 0;                     // Next byte to write (main context)
+    volatile uint16_t tail_ = 0;            // Next byte to read (ISR; main context only when evicting)
+    volatile uint16_t used_ = 0;            // Bytes in the ring, length bytes included
+    volatile uint8_t  remaining_ = 0;       // Bytes left of the message on the wire (0 -> next ring byte is a length)
+    volatile bool     cutLine_ = false;     // Text line cut by an eviction: send '\n' before the next one
+    uint16_t dropped_ = 0;                  // Messages lost since boot (saturates)
+
+    inline uint16_t advance(uint16_t index, uint16_t n)
+    {
+        index += n;
+        return (index >= LOG_TX_RING_SIZE) ? static_cast<uint16_t>(index - LOG_TX_RING_SIZE) : index;
+    }
+
+    inline void countDrop()
+    {
+        if(dropped_ != UINT16_MAX) ++dropped_;
+    }
+
+#if LOG_TX_OVERFLOW == LOG_DROP_OLDEST
+    /// @brief Evict the oldest message (interrupts disabled); the one on the wire is cut short
+    void evictOldest()
+    {
+        if(remaining_ != 0)
+        {
+            tail_ = advance(tail_, remaining_);
+            used_ -= remaining_;
+            remaining_ = 0;
+        #if !LOG_BINARY
+            cutLine_ = true;                // Binary frames resynchronise by themselves
+        #endif
+        }
+        else
+        {
+            const uint8_t size = ring_[tail_];
+            tail_ = advance(tail_, static_cast<uint16_t>(size) + 1);
+            used_ -= static_cast<uint16_t>(size) + 1;
+        }
+        countDrop();
+    }
+#endif
+}
+
+/**
+ * @brief UART data register empty: send the next queued byte, stop when the ring is empty
+ *
+ */
+ISR(USART_UDRE_vect)
+{
+    if(cutLine_)
+    {
+        cutLine_ = false;
+        UDR0 = '\n';
+        return;
+    }
+
+    if(used_ == 0)
+    {
+        UCSR0B &= static_cast<uint8_t>(~_BV(UDRIE0));
+        return;
+    }
+
+    uint16_t tail = tail_;
+    if(remaining_ == 0)
+    {
+        remaining_ = ring_[tail];           // Start of a message: its length
+        tail = advance(tail, 1);
+        --used_;
+    }
+
+    UDR0 = ring_[tail];
+    tail_ = advance(tail, 1);
+    --used_;
+    --remaining_;
+}
+
+namespace logger
+{
+namespace tx
+{
+    /**
+     * @brief Configure USART0 as 8N1 TX at the given baud rate (same divisors as HardwareSerial::begin)
+     *
+     * @param baud - Bits per second (e.g. 115200)
+     */
+    void begin(uint32_t baud)
+    {
+        // Double speed mode gives the smaller error, except for 57600 baud at 16 MHz (bootloader compatibility)
+        uint16_t setting = static_cast<uint16_t>((F_CPU / 4 / baud - 1) / 2);
+        bool doubleSpeed = true;
+        if((F_CPU == 16000000UL && baud == 57600) || setting > 4095)
+        {
+            setting = static_cast<uint16_t>((F_CPU / 8 / baud - 1) / 2);
+            doubleSpeed = false;
+        }
+
+        ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+        {
+            UCSR0A = doubleSpeed ? _BV(U2X0) : 0;
+            UBRR0H = static_cast<uint8_t>(setting >> 8);
+            UBRR0L = static_cast<uint8_t>(setting);
+            UCSR0C = _BV(UCSZ01) | _BV(UCSZ00);     // 8 data bits, no parity, 1 stop bit
+            UCSR0B = _BV(TXEN0);                    // TX only; UDRIE0 is set while the ring holds data
+        }
+    }
+
+    /**
+     * @brief Queue a message for the UART interrupt, applying the overflow policy when the ring is full
+     *
+     * @param bytes - Message to send
+     * @param size - 1..255 bytes
+     * @return true  - Queued (whole)
+     * @return false - Dropped (ring full with LOG_DROP_NEWEST, or message larger than the ring)
+     */
+    bool write(const char* bytes, size_t size)
+    {
+        if(size == 0) return true;
+        const uint16_t needed = static_cast<uint16_t>(size) + 1;
+        if(size > 255 || needed > LOG_TX_RING_SIZE)
+        {
+            countDrop();
+            return false;
+        }
+
+        // Step1: Make room (the ISR only frees space, so it stays free while copying)
+        ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+        {
+        #if LOG_TX_OVERFLOW == LOG_DROP_OLDEST
+            while(LOG_TX_RING_SIZE - used_ < needed) evictOldest();
+        #else
+            if(LOG_TX_RING_SIZE - used_ < needed)
+            {
+                countDrop();
+                return false;
+            }
+        #endif
+        }
+
+        // Step2: Copy outside the critical section (the ISR never reads past used_)
+        uint16_t head = head_;
+        ring_[head] = static_cast<uint8_t>(size);
+        head = advance(head, 1);
+        for(size_t i = 0; i < size; ++i)
+        {
+            ring_[head] = static_cast<uint8_t>(bytes[i]);
+            head = advance(head, 1);
+        }
+        head_ = head;
+
+        // Step3: Publish and (re)start the interrupt
+        ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+        {
+            used_ += needed;
+            UCSR0B |= _BV(UDRIE0);
+        }
+        return true;
+    }
+
+    /**
+     * @brief Largest message write() accepts right now without dropping anything
+     */
+    uint16_t room()
+    {
+        uint16_t used;
+        ATOMIC_BLOCK(ATOMIC_RESTORESTATE) { used = used_; }
+        const uint16_t free = LOG_TX_RING_SIZE - used;
+        return (free <= 1) ? 0 : (free - 1 > 255) ? 255 : static_cast<uint16_t>(free - 1);
+    }
+
+    uint16_t dropped()
+    {
+        return dropped_;
+    }
+
+} // namespace tx
+} // namespace logger
+
+#endif // ARDUINO && LOG_ENABLE && LOG_TX_RING
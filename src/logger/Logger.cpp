@@ -1 +1,107 @@
-#include "logger/Logger.h"
\ No newline at end of file
+#include "logger/Logger.h"
+
+#if defined(ARDUINO) && LOG_ENABLE && LOG_BINARY
+
+namespace logger
+{
+namespace binary
+{
+    namespace
+    {
+        uint8_t  ring_[LOG_BINARY_RING_SIZE];   // Pending frames (bytes)
+        uint16_t head_ = 0;                     // Next byte to write
+        uint16_t tail_ = 0;                     // Next byte to send
+        uint16_t used_ = 0;                     // Bytes pending
+        uint16_t dropped_ = 0;                  // Records dropped since boot (saturates)
+        uint16_t droppedReported_ = 0;          // Part of dropped_ already sent as a marker
+
+        void copyIn(const uint8_t* bytes, uint8_t size)
+        {
+            for(uint8_t i = 0; i < size; ++i)
+            {
+                ring_[head_] = bytes[i];
+                if(++head_ == LOG_BINARY_RING_SIZE) head_ = 0;
+            }
+            used_ += size;
+        }
+
+        /// @brief Queue a "records dropped" marker if some drops were not reported yet and it fits
+        void reportDrops()
+        {
+            if(dropped_ == droppedReported_) return;
+
+            const uint16_t count = dropped_ - droppedReported_;
+            const uint32_t now = millis();
+            uint8_t frame[FRAME_OVERHEAD + HEADER_SIZE + 3];
+            const uint8_t payload = HEADER_SIZE + 3;
+            if(LOG_BINARY_RING_SIZE - used_ < static_cast<int>(sizeof(frame))) return;
+
+            frame[0] = FRAME_SYNC;
+            frame[1] = payload;
+            frame[2] = static_cast<uint8_t>(DROP_RECORD_ID);
+            frame[3] = static_cast<uint8_t>(DROP_RECORD_ID >> 8);
+            memcpy(&frame[4], &now, 4);
+            frame[8] = 'W';
+            frame[9] = TAG_U16;
+            memcpy(&frame[10], &count, 2);
+
+            uint8_t checksum = 0;
+            for(uint8_t i = 2; i < 2 + payload; ++i) checksum ^= frame[i];
+            frame[2 + payload] = checksum;
+
+            copyIn(frame, sizeof(frame));
+            droppedReported_ = dropped_;
+        }
+
+        /// @brief Bytes the output takes right now without blocking (TX ring or Serial buffer)
+        uint16_t outputRoom()
+        {
+        #if LOG_TX_RING
+            return tx::room();
+        #else
+            const int room = Serial.availableForWrite();
+            return (room > 0) ? static_cast<uint16_t>(room) : 0;
+        #endif
+        }
+    }
+
+    bool push(const uint8_t* frame, uint8_t size)
+    {
+        reportDrops();
+
+        if(LOG_BINARY_RING_SIZE - used_ < size)
+        {
+            if(dropped_ != UINT16_MAX) ++dropped_;     // Drop newest: the queued frames stay intact
+            return false;
+        }
+
+        copyIn(frame, size);
+        return true;
+    }
+
+    void flush()
+    {
+        reportDrops();
+
+        uint16_t room;
+        while(used_ != 0 && (room = outputRoom()) > 0)
+        {
+            // Contiguous chunk up to the end of the ring / the output room
+            uint16_t chunk = (tail_ + used_ <= LOG_BINARY_RING_SIZE) ? used_ : (LOG_BINARY_RING_SIZE - tail_);
+            if(chunk > room) chunk = room;
+
+            logger::out(reinterpret_cast<const char*>(&ring_[tail_]), chunk);
+            tail_ += chunk;
+            if(tail_ == LOG_BINARY_RING_SIZE) tail_ = 0;
+            used_ -= chunk;
+        }
+    }
+
+    uint16_t room() { return static_cast<uint16_t>(LOG_BINARY_RING_SIZE - used_); }
+
+    uint16_t dropped() { return dropped_; }
+
+} // namespace binary
+} // namespace logger
+
+#endif // ARDUINO && LOG_ENABLE && LOG_BINARY
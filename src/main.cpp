@@ -16,6 +16,7 @@
  *  3. Converts the ADC reading to resistance using the voltage divider formula.
  *  4. converts the resistance scaled by 10 (0.1Ω) to temperature also scaled by10 to have 0.1°C  resolution using a LUT with linear interpolation.
  *  5. Applies an optional Exponential Moving Average (EMA) filter to smooth out temperature readings.
+ *  6. Compensates the probe thermal lag (first-order model, per-probe tau) to estimate the air temperature.
  * 
  * - How data for the NTC LUT was generated:
  *   NTC data is store on a LUT that contains resistance and temperature pairs.
@@ -26,8 +27,8 @@
  *   }; 
  * 
  * @note
- *  - Read temperature from both evaporator and fridge compartment sensors every 2 seconds
- *  - Log the readings via Serial
+ *  - Read temperature from both evaporator and fridge compartment sensors on their own periods (SensorArray, Config Sampling::)
+ *  - Log the readings via the UART (non-blocking logger output, Logger.h)
  *  - Uses C++11 features and modular design with interfaces and concrete implementations
  *  - Designed for Arduino Nano with 10-bit ADC 
  * 
@@ -45,10 +46,15 @@
 #include "config/Config.h"                              // For App configuration constants                
 
 #include "Model/TemperatureSensor.h"                    // Builer pattern components
+#include "Model/SensorArray.h"                          // Per-channel sampling schedules
+#include "Model/ReadingHistory.h"                       // Rolling mean/min/max per channel
+#include "Model/RateEstimator.h"                        // Rate of change per channel
 #include "Model/AdcSampler.h"                           // To sampler ADC 
 #include "Model/VoltageDividerResistanceConverter.h"    // To convert ADC to Resistance
 #include "Model/LutTemperatureConverter.h"              // To convert Resistance to Temperature
 #include "Filter/EmaFilter.h"                           // For temp filtering
+#include "Filter/LagCompensationFilter.h"               // For probe-lag compensation
+#include "Filter/FilterChain.h"                         // To run both as one filter
 #include "utils/init_helpers.h"                         // For subsystem initialization(e.g, evaporatorSampler.begin() ...)
 
 // --- Global/static Objects for the sensor components ---
@@ -77,20 +83,49 @@ static VoltageDividerResistanceConverter resistanceConverter(Sensors::PULLUP_FIX
 // Step3: Create Temperature Converter instance (Resistance->Temperature)
 static LutTemperatureConverter temperatureConverter;
 
-// Step4: Create Filter instance (optional)
-static EmaFilter<int16_t> fridgeFilter(Filtering::EMA_ALPHA_DEFAULT);     // EMA
-static EmaFilter<int16_t> evaporatorFilter(Filtering::EMA_ALPHA_DEFAULT); // EMA
+// Step4: Create Filter instance (optional): EMA, then the probe-lag compensation (air temperature estimate, per-probe tau)
+// The lag stage takes dt from the reading timestamps (follows period changes and readings skipped for faults)
+using ProbeFilter = FilterChain<int16_t, EmaFilter<int16_t>, LagCompensationFilter<>>;
 
-// Step5: Create TemperatureSensor instance using the builder pattern
-static TemperatureSensor fridgeTempSensor = TemperatureSensor();
-static TemperatureSensor evaporatorSensor = TemperatureSensor();
+static ProbeFilter fridgeFilter(
+  EmaFilter<int16_t>(Filtering::EMA_ALPHA_DEFAULT),
+  LagCompensationFilter<>(Filtering::PROBE_TAU_COMPARTMENT_MS, Sampling::COMPARTMENT_PERIOD_MS)
+);
+static ProbeFilter evaporatorFilter(
+  EmaFilter<int16_t>(Filtering::EMA_ALPHA_DEFAULT),
+  LagCompensationFilter<>(Filtering::PROBE_TAU_EVAPORATOR_MS, Sampling::EVAPORATOR_PERIOD_MS)
+);
+
+// Step5: Create the sensor array (one TemperatureSensor pipeline per channel, built with the builder pattern)
+enum Channel : uint8_t { FRIDGE, EVAPORATOR, CHANNEL_COUNT };
+static const char* const CHANNEL_NAMES[CHANNEL_COUNT] = { "Fridge", "Evaporator" };
+
+static SensorArray<CHANNEL_COUNT> sensors;
+static ReadingHistory<Sampling::HISTORY_CAPACITY> histories[CHANNEL_COUNT];   // Last readings of each channel
+static RateEstimator<Sampling::RATE_WINDOW> rates[CHANNEL_COUNT];              // Trend of each channel (defrost end, door open)
+static constexpr uint16_t LOG_DROP_REPORT_SIZE = 84;                            // Longest drop report line: 20-byte prefix + 62-char message + CRLF
+
+// Step6: Change notification: log a channel only when its temperature moved beyond the deadband (or on faults / heartbeat)
+static void logReading(const Reading& reading, void* context)
+{
+  const char* name = CHANNEL_NAMES[reinterpret_cast<uintptr_t>(context)];
+  (void)name;                                       // Unused when LOG_LEVEL is below WARN
+
+  if(reading.isValid())
+  {
+    LOGI("%s Temp:%.1f °C", name, reading.celsius());
+  }else if(reading.isClamped()){
+    LOGW("%s Temp:%.1f °C (outside the NTC table, status %d)", name, reading.celsius(), static_cast<int>(reading.status));
+  }else{
+    LOGW("%s Temp: Sensor fault (status %d)", name, static_cast<int>(reading.status));
+  }
+}
 
 
 // --- SETUP ---
 void setup() {
   
-  Serial.begin(115200);
-  while (!Serial){delay(10);} // Wait a little more until Serial initialize  
+  LOG_BEGIN(115200);    // Logger output: UART0 TX ring sent by interrupt (LOG_TX_RING=1) or Serial
 
   LOGI("System initializing...");
    
@@ -110,23 +145,31 @@ void setup() {
 
   
   // 3. Build TemperatureSensor for the Fridge Compartment
-  fridgeTempSensor
+  sensors.sensor(FRIDGE)
     .addSampler(&fridgeCompartmentSampler)
     .addResistanceConverter(&resistanceConverter)
     .addTemperatureConverter(&temperatureConverter)
     .addFilter(&fridgeFilter)
     .setUnits(TemperatureUnit::Celsius)
+    .onChange(&logReading, reinterpret_cast<void*>(static_cast<uintptr_t>(FRIDGE)))
     .build();
 
   // 4. Build TemperatureSensor for the Evaporator
-  evaporatorSensor
+  sensors.sensor(EVAPORATOR)
     .addSampler(&evaporatorSampler)
     .addResistanceConverter(&resistanceConverter)
     .addTemperatureConverter(&temperatureConverter)
     .addFilter(&evaporatorFilter)
     .setUnits(TemperatureUnit::Celsius)
+    .onChange(&logReading, reinterpret_cast<void*>(static_cast<uintptr_t>(EVAPORATOR)))
     .build();
 
+  // 5. Sampling schedules
+  sensors
+    .setPeriod(FRIDGE, Sampling::COMPARTMENT_PERIOD_MS)
+    .setPeriod(EVAPORATOR, Sampling::EVAPORATOR_PERIOD_MS)
+    .begin();
+
   LOGI("System initialized.");
    
 }
@@ -134,39 +177,33 @@ void setup() {
 
 // --- LOOP ---
 void loop() {
- 
- 
-  LOGD("\n-----   Read Temperatures ----");
 
-  int16_t fridgeTemp_x10 = fridgeTempSensor.readTemperature_x10();
-  int16_t evaporatorTemp_x10 = evaporatorSensor.readTemperature_x10();
+  // Send the queued binary log records (LOG_BINARY=1), never blocks; no-op for text logs
+  LOG_FLUSH();
 
-  LOGD("\n--- EVAPORATOR ---");
-  if(fridgeTemp_x10 != -32768)
+  // Telemetry: log messages lost to a full output ring (reported once per change).
+  // Only sent when the output has room for it: a report dropped in turn (or evicting older lines with
+  // LOG_DROP_OLDEST) would add to the count it reports. A lost report is folded into the reported count.
+  static uint16_t reportedLogDrops = 0;
+  if(LOG_DROPPED() != reportedLogDrops && LOG_FITS(LOG_DROP_REPORT_SIZE))
   {
-    float fridgeTempC = fridgeTempSensor.readTemperatureC();
-    LOGI("Fridge Temp:%.1f °C", fridgeTempC);
-  }else{
-    LOGW("Fridge Temp: Sensor reading error");
+    LOGW("Logger: %u message(s) dropped since boot (output ring full)", LOG_DROPPED());
+    reportedLogDrops = LOG_DROPPED();
   }
-  
-  LOGD("\n---- FRIDGE COMPARTMENT ---- ");
-
-  if(evaporatorTemp_x10 != -32768)
-  {
-    
-    float evaporatorTempC = evaporatorSensor.readTemperatureC();   
-    LOGI("Evaporator Temp:%.1f °C", evaporatorTempC);
 
-  }else{
-    
-    LOGW("Evaporator Temp: Sensor reading error");
-  
-  }
-  
-  LOGD("---------------------------------\n");
- 
-  // Wait before next reading
-  delay(2000); // 2 seconds
-  
+  // Advance the acquisition in flight / start the next due channel (never blocks on the ADC).
+  // Completed readings that changed are logged by logReading() from inside update()
+  uint8_t channel;
+  if(!sensors.update(channel)) return;
+
+  // Every reading feeds the channel history and rate estimator, logged or not
+  const Reading& reading = sensors.reading(channel);
+  ReadingHistory<Sampling::HISTORY_CAPACITY>& history = histories[channel];
+  history.push(reading);
+  RateEstimator<Sampling::RATE_WINDOW>& rate = rates[channel];
+  rate.push(reading);
+
+  LOGD("%s: raw %u, R %lu x0.1 Ohm, unfiltered %d", CHANNEL_NAMES[channel], reading.adc_raw, (unsigned long)reading.resistance_x10, reading.unfiltered_x10);
+  LOGD("%s: last %u readings x10 min %d / mean %d / max %d", CHANNEL_NAMES[channel], history.size(), history.min_x10(), history.mean_x10(), history.max_x10());
+  if(rate.isReady()) LOGD("%s: rate %d x0.1 °C/min over %u readings", CHANNEL_NAMES[channel], rate.rate_x10_per_min(), rate.size());
 }
@@ -0,0 +1,33 @@
+// ====================================================================
+// Arduino.h (native unit tests)
+// Host stand-in for the parts of the Arduino core the logger sources use.
+// millis() and the Serial methods are defined by the test that needs them.
+// ====================================================================
+#pragma once
+
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <avr/pgmspace.h>
+
+class __FlashStringHelper;
+#define F(string_literal) (reinterpret_cast<const __FlashStringHelper*>(PSTR(string_literal)))
+
+// Nano analog pins (pins_arduino.h)
+static const uint8_t A0 = 14;
+static const uint8_t A1 = 15;
+
+unsigned long millis();
+inline void delay(unsigned long) {}
+
+struct HostSerial
+{
+    void begin(unsigned long) {}
+    size_t write(const uint8_t* bytes, size_t size);
+    int availableForWrite();
+    explicit operator bool() const { return true; }
+};
+extern HostSerial Serial;
@@ -0,0 +1,7 @@
+// ====================================================================
+// avr/interrupt.h (native unit tests)
+// Host stand-in: an ISR is a plain function the test calls to play the hardware.
+// ====================================================================
+#pragma once
+
+#define ISR(vector) extern "C" void vector(void)
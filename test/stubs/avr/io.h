@@ -0,0 +1,21 @@
+// ====================================================================
+// avr/io.h (native unit tests)
+// Host stand-in: USART0 registers as plain variables (defined by the test).
+// ====================================================================
+#pragma once
+
+#include <stdint.h>
+
+#ifndef F_CPU
+    #define F_CPU 16000000UL
+#endif
+
+#define _BV(bit) (1u << (bit))
+
+extern volatile uint8_t UDR0, UCSR0A, UCSR0B, UCSR0C, UBRR0H, UBRR0L;
+
+#define U2X0   1
+#define UCSZ00 1
+#define UCSZ01 2
+#define TXEN0  3
+#define UDRIE0 5
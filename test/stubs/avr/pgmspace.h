@@ -0,0 +1,23 @@
+// ====================================================================
+// avr/pgmspace.h (native unit tests)
+// Host stand-in: one address space, flash accessors are plain RAM accesses.
+// ====================================================================
+#pragma once
+
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#define PROGMEM
+#define PGM_P const char*
+#define PSTR(string_literal) (string_literal)
+
+#define pgm_read_byte(address)  (*reinterpret_cast<const uint8_t*>(address))
+#define pgm_read_word(address)  (*reinterpret_cast<const uint16_t*>(address))
+#define pgm_read_dword(address) (*reinterpret_cast<const uint32_t*>(address))
+#define memcpy_P  memcpy
+#define strlen_P  strlen
+#define strncpy_P strncpy
+
+inline int vsnprintf_P(char* buffer, size_t size, const char* fmt, va_list ap) { return vsnprintf(buffer, size, fmt, ap); }
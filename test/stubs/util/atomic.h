@@ -0,0 +1,8 @@
+// ====================================================================
+// util/atomic.h (native unit tests)
+// Host stand-in: tests are single threaded, the block runs once.
+// ====================================================================
+#pragma once
+
+#define ATOMIC_RESTORESTATE 0
+#define ATOMIC_BLOCK(type) for(int atomic_once_ = (static_cast<void>(type), 1); atomic_once_; atomic_once_ = 0)
@@ -0,0 +1,273 @@
+/**
+ * @file test_main.cpp
+ * @brief Binary log round trip: BinaryLog.h records -> Logger.cpp ring -> wire -> LogDecoder.h text
+ *        (pio test -e native -f test_binary_log)
+ *
+ * @details
+ *  - The device sources are built in their LOG_BINARY=1 configuration on the host stubs (test/stubs),
+ *    with Serial as output (LOG_TX_RING=0) so the test controls how many bytes the output accepts.
+ *  - Message IDs are the low 16 bits of the format string address: the format strings are placed in a
+ *    64 KiB aligned block that doubles as the firmware image given to the decoder.
+ *  - Host int is 32 bits, so int arguments travel as TAG_I32 here (TAG_I16 on the AVR): the expected
+ *    text avoids the few cases where the width shows (%u / %x of negative values).
+ */
+
+#define ARDUINO 10819
+#define LOG_ENABLE 1
+#define LOG_BINARY 1
+#define LOG_TX_RING 0
+
+#include <unity.h>
+
+#include <string>
+#include <vector>
+
+#include "../../src/logger/Logger.cpp"
+#include "log_decoder/LogDecoder.h"
+
+namespace
+{
+    std::vector<uint8_t> wire;          // Bytes Serial sent
+    int serialRoom = 0;                 // Bytes Serial accepts before "its buffer is full"
+    unsigned long now = 0;              // millis()
+
+    constexpr uint32_t IMAGE_SIZE = 65536;
+
+    /// @brief Format strings at known 16-bit addresses + the same bytes as firmware image for the decoder
+    class FlashImage
+    {
+        public:
+
+            FlashImage(): storage_(2 * IMAGE_SIZE, 0), used_(0x100)
+            {
+                const uintptr_t address = reinterpret_cast<uintptr_t>(storage_.data());
+                base_ = storage_.data() + ((IMAGE_SIZE - (address % IMAGE_SIZE)) % IMAGE_SIZE);
+            }
+
+            /// @brief Store a format string, return it at its "flash address"
+            const char* add(const char* fmt)
+            {
+                char* at = reinterpret_cast<char*>(base_ + used_);
+                strcpy(at, fmt);
+                used_ += static_cast<uint32_t>(strlen(fmt) + 1);
+                return at;
+            }
+
+            std::vector<uint8_t> image() const { return std::vector<uint8_t>(base_, base_ + IMAGE_SIZE); }
+
+        private:
+
+            std::vector<uint8_t> storage_;
+            uint8_t* base_;
+            uint32_t used_;
+    };
+
+    /// @brief Send everything queued (output never full)
+    void drain()
+    {
+        for(int i = 0; i < 4; ++i)                              // Second pass sends a pending drop marker
+        {
+            serialRoom = 1024;
+            logger::binary::flush();
+        }
+    }
+
+    std::vector<std::string> decodeAll(const std::vector<uint8_t>& image, const std::vector<uint8_t>& bytes)
+    {
+        std::vector<std::string> lines;
+        log_decoder::FrameDecoder decoder(image);
+        const auto collect = [&](const std::string& line) { lines.push_back(line); };
+        decoder.feed(bytes.data(), bytes.size(), collect);
+        decoder.finish(collect);
+        return lines;
+    }
+
+    enum Compartment { FRIDGE_COMPARTMENT = 0, EVAPORATOR_COMPARTMENT = 1 };
+}
+
+HostSerial Serial;
+
+size_t HostSerial::write(const uint8_t* bytes, size_t size)
+{
+    wire.insert(wire.end(), bytes, bytes + size);
+    serialRoom -= static_cast<int>(size);
+    return size;
+}
+
+int HostSerial::availableForWrite() { return serialRoom; }
+
+unsigned long millis() { return now; }
+
+void setUp()
+{
+    drain();
+    wire.clear();
+    serialRoom = 0;
+}
+
+void tearDown() {}
+
+void test_records_round_trip_to_text()
+{
+    FlashImage flash;
+    const char* temp    = flash.add("%s Temp:%.1f C");
+    const char* raw     = flash.add("raw %u, R %lu x0.1 Ohm, unfiltered %d");
+    const char* misc    = flash.add("ch %d '%c' ok=%d at %p hex %04x");
+    const char* plain   = flash.add("plain message");
+
+    now = 1000;
+    logger::binary::log_binary('I', temp, "Fridge", 4.5f);
+    now = 1250;
+    logger::binary::log_binary('D', raw, static_cast<uint16_t>(512), 123456UL, static_cast<int16_t>(-41));
+    now = 70000;
+    logger::binary::log_binary('W', misc, EVAPORATOR_COMPARTMENT, 'A', true, reinterpret_cast<const void*>(0x1234), 0xBEEF);
+    now = 4294967295UL;
+    logger::binary::log_binary('E', plain);
+    drain();
+
+    const std::vector<std::string> lines = decodeAll(flash.image(), wire);
+    TEST_ASSERT_EQUAL_UINT32(4, lines.size());
+    TEST_ASSERT_EQUAL_STRING("[1000 ms] [I] Fridge Temp:4.5 C", lines[0].c_str());
+    TEST_ASSERT_EQUAL_STRING("[1250 ms] [D] raw 512, R 123456 x0.1 Ohm, unfiltered -41", lines[1].c_str());
+    TEST_ASSERT_EQUAL_STRING("[70000 ms] [W] ch 1 'A' ok=1 at 0x1234 hex beef", lines[2].c_str());
+    TEST_ASSERT_EQUAL_STRING("[4294967295 ms] [E] plain message", lines[3].c_str());
+}
+
+void test_long_string_is_truncated_to_the_frame()
+{
+    FlashImage flash;
+    const char* fmt = flash.add("%s");
+    const std::string text = "0123456789abcdefghijklmnopqrstuvwxyz0123456789abcdefghijklmnopqrstuvwxyz";
+
+    now = 5;
+    logger::binary::log_binary('I', fmt, text.c_str());
+    drain();
+
+    // Frame: sync, len, header, tag, characters, NUL, checksum
+    const size_t kept = LOG_BINARY_MAX_FRAME - logger::binary::FRAME_OVERHEAD - logger::binary::HEADER_SIZE - 2;
+    TEST_ASSERT_EQUAL_UINT32(LOG_BINARY_MAX_FRAME, wire.size());
+    const std::vector<std::string> lines = decodeAll(flash.image(), wire);
+    TEST_ASSERT_EQUAL_UINT32(1, lines.size());
+    TEST_ASSERT_EQUAL_STRING(("[5 ms] [I] " + text.substr(0, kept)).c_str(), lines[0].c_str());
+}
+
+void test_full_ring_reports_dropped_records()
+{
+    FlashImage flash;
+    const char* plain = flash.add("plain message");
+    const uint16_t droppedBefore = logger::binary::dropped();
+
+    // Output stalled: 10-byte frames fill the ring, the rest are dropped and counted
+    const int fit = LOG_BINARY_RING_SIZE / (logger::binary::FRAME_OVERHEAD + logger::binary::HEADER_SIZE);
+    now = 42;
+    for(int i = 0; i < fit + 5; ++i) logger::binary::log_binary('I', plain);
+    logger::binary::flush();
+    TEST_ASSERT_EQUAL_UINT32(0, wire.size());
+    TEST_ASSERT_EQUAL_UINT16(5, logger::binary::dropped() - droppedBefore);
+
+    // Output back: the queued records, then one marker with the count
+    drain();
+    const std::vector<std::string> lines = decodeAll(flash.image(), wire);
+    TEST_ASSERT_EQUAL_UINT32(fit + 1, lines.size());
+    TEST_ASSERT_EQUAL_STRING("[42 ms] [I] plain message", lines[0].c_str());
+    TEST_ASSERT_EQUAL_STRING("[42 ms] [W] logger: 5 record(s) dropped (ring full)", lines[fit].c_str());
+}
+
+void test_output_room_is_never_exceeded()
+{
+    FlashImage flash;
+    const char* fmt = flash.add("value %ld");
+
+    for(long i = 0; i < 10; ++i) logger::binary::log_binary('D', fmt, i);
+
+    // A few bytes per loop: flush() never writes more than availableForWrite()
+    for(int loop = 0; loop < 100; ++loop)
+    {
+        serialRoom = 7;
+        logger::binary::flush();
+        TEST_ASSERT_TRUE(serialRoom >= 0);
+    }
+
+    const std::vector<std::string> lines = decodeAll(flash.image(), wire);
+    TEST_ASSERT_EQUAL_UINT32(10, lines.size());
+    TEST_ASSERT_EQUAL_STRING("[42 ms] [D] value 9", lines[9].c_str());
+}
+
+void test_decoder_resyncs_after_corruption()
+{
+    FlashImage flash;
+    const char* fmt = flash.add("record %d");
+
+    std::vector<size_t> ends;
+    now = 7;
+    for(int i = 0; i < 3; ++i)
+    {
+        logger::binary::log_binary('I', fmt, i);
+        drain();
+        ends.push_back(wire.size());
+    }
+
+    std::vector<uint8_t> corrupted = {0x00, logger::binary::FRAME_SYNC, 0xF0};     // Noise + a false sync (long frame)
+    corrupted.insert(corrupted.end(), wire.begin(), wire.end());
+    corrupted[3 + ends[0] + 4] ^= 0x5A;                                            // Second frame, inside the payload
+
+    log_decoder::FrameDecoder decoder(flash.image());
+    std::vector<std::string> lines;
+    const auto collect = [&](const std::string& line) { lines.push_back(line); };
+
+    // The false sync waits for its 243 bytes: nothing can be decoded before the end of the capture
+    decoder.feed(corrupted.data(), corrupted.size(), collect);
+    TEST_ASSERT_EQUAL_UINT32(0, lines.size());
+    TEST_ASSERT_EQUAL_UINT32(corrupted.size() - 1, decoder.pending());
+
+    decoder.finish(collect);
+    TEST_ASSERT_EQUAL_UINT32(2, lines.size());
+    TEST_ASSERT_EQUAL_STRING("[7 ms] [I] record 0", lines[0].c_str());
+    TEST_ASSERT_EQUAL_STRING("[7 ms] [I] record 2", lines[1].c_str());
+    TEST_ASSERT_EQUAL_UINT32(2, decoder.decoded());
+    TEST_ASSERT_EQUAL_UINT32(0, decoder.pending());
+    TEST_ASSERT_EQUAL_UINT32(3 + (ends[1] - ends[0]), decoder.skipped());
+}
+
+void test_decoder_emits_each_frame_when_its_last_byte_arrives()
+{
+    FlashImage flash;
+    const char* fmt = flash.add("sample %u of %s");
+
+    std::vector<size_t> ends;
+    for(uint16_t i = 0; i < 6; ++i)
+    {
+        now = 100u * i;
+        logger::binary::log_binary('D', fmt, i, (i % 2) ? "evaporator" : "fridge");
+        drain();
+        ends.push_back(wire.size());
+    }
+
+    // Byte by byte, like a serial port: a line appears exactly with the last byte of its frame
+    log_decoder::FrameDecoder decoder(flash.image());
+    std::vector<std::string> lines;
+    size_t frame = 0;
+    for(size_t i = 0; i < wire.size(); ++i)
+    {
+        decoder.feed(&wire[i], 1, [&](const std::string& line) { lines.push_back(line); });
+        if(i + 1 == ends[frame]) ++frame;
+        TEST_ASSERT_EQUAL_UINT32(frame, lines.size());
+    }
+
+    TEST_ASSERT_EQUAL_UINT32(0, decoder.pending());
+    TEST_ASSERT_TRUE(lines == decodeAll(flash.image(), wire));
+    TEST_ASSERT_EQUAL_STRING("[500 ms] [D] sample 5 of evaporator", lines[5].c_str());
+    TEST_ASSERT_EQUAL_UINT32(0, decoder.skipped());
+}
+
+int main(int, char**)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_records_round_trip_to_text);
+    RUN_TEST(test_long_string_is_truncated_to_the_frame);
+    RUN_TEST(test_full_ring_reports_dropped_records);
+    RUN_TEST(test_output_room_is_never_exceeded);
+    RUN_TEST(test_decoder_resyncs_after_corruption);
+    RUN_TEST(test_decoder_emits_each_frame_when_its_last_byte_arrives);
+    return UNITY_END();
+}
@@ -0,0 +1,188 @@
+/**
+ * @file test_main.cpp
+ * @brief LogTx interrupt-driven output on stubbed USART0 registers (pio test -e native -f test_log_tx)
+ *
+ * @details
+ *  - The device sources are built in their text + LOG_TX_RING=1 configuration on the host stubs (test/stubs);
+ *    the test plays the UART: each call of USART_UDRE_vect() while UDRIE0 is set sends one byte (UDR0).
+ *  - Checks the baud divisors, whole lines in order, whole-message drops with LOG_DROP_NEWEST, room() and
+ *    that a drop report gated on LOG_FITS() (as main.cpp does) never adds to the count it reports.
+ */
+
+#define ARDUINO 10819
+#define LOG_ENABLE 1
+#define LOG_BINARY 0
+#define LOG_TX_RING 1
+#define LOG_TIMESTAMP 1
+
+#include <unity.h>
+
+#include <string>
+
+#include "../../src/logger/LogTx.cpp"
+
+volatile uint8_t UDR0, UCSR0A, UCSR0B, UCSR0C, UBRR0H, UBRR0L;
+
+namespace
+{
+    std::string wire;                   // Bytes the UART sent
+    unsigned long now = 0;              // millis()
+
+    /// @brief Let the UART send up to n bytes (stops when the interrupt disables itself)
+    void pump(long n)
+    {
+        for(long i = 0; i < n && (UCSR0B & _BV(UDRIE0)); ++i)
+        {
+            UDR0 = 0;
+            USART_UDRE_vect();
+            if(UDR0) wire += static_cast<char>(UDR0);
+        }
+    }
+
+    /// @brief Complete "...\r\n" lines on the wire
+    int countLines(const std::string& text)
+    {
+        int lines = 0;
+        for(size_t at = text.find("\r\n"); at != std::string::npos; at = text.find("\r\n", at + 2)) ++lines;
+        return lines;
+    }
+}
+
+unsigned long millis() { return now; }
+
+void setUp()
+{
+    pump(1L << 20);
+    wire.clear();
+    now = 0;
+}
+
+void tearDown() {}
+
+void test_begin_programs_usart0_like_hardware_serial()
+{
+    logger::tx::begin(115200);
+    TEST_ASSERT_EQUAL_UINT8(_BV(U2X0), UCSR0A);
+    TEST_ASSERT_EQUAL_UINT16(16, (UBRR0H << 8) | UBRR0L);
+    TEST_ASSERT_EQUAL_UINT8(_BV(UCSZ01) | _BV(UCSZ00), UCSR0C);
+    TEST_ASSERT_EQUAL_UINT8(_BV(TXEN0), UCSR0B);
+
+    logger::tx::begin(57600);                          // Bootloader compatibility: no double speed
+    TEST_ASSERT_EQUAL_UINT8(0, UCSR0A);
+    TEST_ASSERT_EQUAL_UINT16(16, (UBRR0H << 8) | UBRR0L);
+
+    logger::tx::begin(9600);
+    TEST_ASSERT_EQUAL_UINT8(_BV(U2X0), UCSR0A);
+    TEST_ASSERT_EQUAL_UINT16(207, (UBRR0H << 8) | UBRR0L);
+
+    logger::tx::begin(115200);
+}
+
+void test_lines_arrive_whole_and_in_order()
+{
+    now = 1234;
+    LOGI("first %d", 1);
+    LOGW_SIMPLE("second");
+    TEST_ASSERT_TRUE((UCSR0B & _BV(UDRIE0)) != 0);     // Interrupt armed by write()
+
+    pump(1L << 20);
+    TEST_ASSERT_EQUAL_STRING("[1234 ms] [I] first 1\r\n[1234 ms] [W] second\r\n", wire.c_str());
+    TEST_ASSERT_TRUE((UCSR0B & _BV(UDRIE0)) == 0);     // Disarmed once the ring is empty
+}
+
+void test_slow_uart_drops_whole_messages_only()
+{
+    const uint16_t droppedBefore = logger::tx::dropped();
+
+    const int sent = 200;
+    for(int k = 0; k < sent; ++k)
+    {
+        LOGI("line %d with some payload to fill the ring quickly", k);
+        pump(20);                                       // UART slower than the logger
+    }
+    pump(1L << 20);
+
+    const int dropped = logger::tx::dropped() - droppedBefore;
+    TEST_ASSERT_GREATER_THAN(0, dropped);
+    TEST_ASSERT_EQUAL_INT(sent - dropped, countLines(wire));
+
+    // Every line on the wire is complete, in order, never spliced with another one
+    int previous = -1;
+    size_t start = 0;
+    for(size_t end = wire.find("\r\n"); end != std::string::npos; start = end + 2, end = wire.find("\r\n", start))
+    {
+        int k = -1;
+        char tail[64] = {0};
+        TEST_ASSERT_EQUAL_INT(2, sscanf(wire.substr(start, end - start).c_str(), "[0 ms] [I] line %d %63[^\n]", &k, tail));
+        TEST_ASSERT_EQUAL_STRING("with some payload to fill the ring quickly", tail);
+        TEST_ASSERT_GREATER_THAN(previous, k);
+        previous = k;
+    }
+}
+
+void test_room_is_the_largest_message_accepted()
+{
+    TEST_ASSERT_EQUAL_UINT16(255, logger::tx::room());  // Empty ring: one message of at most 255 bytes
+
+    const std::string block(100, 'x');
+    TEST_ASSERT_TRUE(logger::tx::write(block.data(), block.size()));
+    TEST_ASSERT_EQUAL_UINT16(LOG_TX_RING_SIZE - 101 - 1, logger::tx::room());
+
+    const uint16_t droppedBefore = logger::tx::dropped();
+    const std::string tooLong(logger::tx::room() + 1u, 'y');
+    TEST_ASSERT_FALSE(logger::tx::write(tooLong.data(), tooLong.size()));
+    TEST_ASSERT_EQUAL_UINT16(droppedBefore + 1, logger::tx::dropped());
+
+    const std::string exact(logger::tx::room(), 'z');
+    TEST_ASSERT_TRUE(logger::tx::write(exact.data(), exact.size()));
+    TEST_ASSERT_EQUAL_UINT16(0, logger::tx::room());
+    TEST_ASSERT_EQUAL_UINT16(droppedBefore + 1, logger::tx::dropped());
+
+    pump(1L << 20);
+    TEST_ASSERT_EQUAL_UINT32(block.size() + exact.size(), wire.size());
+}
+
+void test_gated_drop_report_never_counts_itself()
+{
+    constexpr uint16_t reportSize = 84;                 // main.cpp LOG_DROP_REPORT_SIZE
+    uint16_t reported = logger::tx::dropped();
+    int reports = 0;
+
+    // main.cpp loop(): application lines with a slow UART, then the drop report when it fits
+    const auto loopOnce = [&](bool traffic, int k)
+    {
+        if(traffic) LOGI("reading %d: some payload to keep the output ring busy", k);
+        if(logger::tx::dropped() != reported && LOG_FITS(reportSize))
+        {
+            const uint16_t before = logger::tx::dropped();
+            LOGW("Logger: %u message(s) dropped since boot (output ring full)", logger::tx::dropped());
+            TEST_ASSERT_EQUAL_UINT16(before, logger::tx::dropped());   // Gated: the report itself is never lost
+            reported = logger::tx::dropped();
+            ++reports;
+        }
+        pump(15);
+    };
+
+    // Bursts overflow the ring, the report goes out in the quieter loops between them
+    const uint16_t droppedBefore = logger::tx::dropped();
+    for(int k = 0; k < 300; ++k) loopOnce(k % 60 < 30, k);
+    TEST_ASSERT_GREATER_THAN(0, logger::tx::dropped() - droppedBefore);
+    TEST_ASSERT_GREATER_THAN(0, reports);
+
+    // Traffic stops: at most the pending report goes out, then nothing (no report feeding the count)
+    const int reportsWhileBusy = reports;
+    for(int k = 0; k < 1000; ++k) loopOnce(false, k);
+    TEST_ASSERT_LESS_OR_EQUAL(reportsWhileBusy + 1, reports);
+    TEST_ASSERT_EQUAL_UINT16(reported, logger::tx::dropped());
+}
+
+int main(int, char**)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_begin_programs_usart0_like_hardware_serial);
+    RUN_TEST(test_lines_arrive_whole_and_in_order);
+    RUN_TEST(test_slow_uart_drops_whole_messages_only);
+    RUN_TEST(test_room_is_the_largest_message_accepted);
+    RUN_TEST(test_gated_drop_report_never_counts_itself);
+    return UNITY_END();
+}
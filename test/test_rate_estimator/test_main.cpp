@@ -0,0 +1,133 @@
+/**
+ * @file test_main.cpp
+ * @brief RateEstimator against a double least-squares reference (pio test -e native -f test_rate_estimator)
+ *
+ * @details
+ *  - The reference refits the window from scratch on every query, with the estimator's own time quantization
+ *    (2^Sampling::RATE_TIME_SHIFT ms) and eviction rules (window by count and by RATE_MAX_SPAN time units).
+ *  - Random walks cross the millis() wrap, mix the 2 s and 250 ms periods and insert long gaps (faults).
+ */
+
+#include <unity.h>
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "Model/RateEstimator.h"
+
+namespace
+{
+    struct Point { double t; double x; };
+
+    constexpr double TIME_WRAP = 67108864.0;     // 2^32 ms in time units (2^26)
+
+    /// @brief Least-squares slope in x10 °C per time unit (NAN when undefined)
+    double referenceSlope(const std::vector<Point>& window)
+    {
+        const double n = static_cast<double>(window.size());
+        if(window.size() < 2) return NAN;
+
+        double st = 0, sx = 0, stt = 0, stx = 0;
+        for(const Point& p : window) { st += p.t; sx += p.x; stt += p.t * p.t; stx += p.t * p.x; }
+
+        const double den = n * stt - st * st;
+        return (den > 0) ? (n * stx - st * sx) / den : NAN;
+    }
+
+    /// @brief Reference rate (x10 °C/min) of the last readings the estimator keeps
+    double referenceRate(const std::vector<Point>& all, uint8_t window, size_t& kept)
+    {
+        const double newest = all.back().t;
+        std::vector<Point> fit;
+        for(size_t i = all.size(); i-- > 0 && fit.size() < window;)
+        {
+            const double age = std::fmod(newest - all[i].t + TIME_WRAP, TIME_WRAP);
+            if(age > RateEstimator<>::RATE_MAX_SPAN) break;
+            fit.push_back({-age, all[i].x});
+        }
+        kept = fit.size();
+        return referenceSlope(fit) * 60000.0 / static_cast<double>(1u << Sampling::RATE_TIME_SHIFT);
+    }
+}
+
+void setUp() {}
+void tearDown() {}
+
+void test_not_ready_below_two_readings()
+{
+    RateEstimator<16> rate;
+    TEST_ASSERT_FALSE(rate.isReady());
+    TEST_ASSERT_EQUAL_INT16(Sensors::INVALID_READING_X10, rate.rate_x10_per_min());
+
+    rate.push(100, 5000);
+    TEST_ASSERT_FALSE(rate.isReady());
+    TEST_ASSERT_EQUAL_INT16(Sensors::INVALID_READING_X10, rate.rate_x10_per_min());
+
+    rate.push(104, 6920);
+    TEST_ASSERT_TRUE(rate.isReady());
+}
+
+void test_linear_ramp_across_millis_wrap()
+{
+    // +/-4 x10 °C every 1920 ms (30 time units) -> +/-12.5 °C/min, exact in the time quantization
+    RateEstimator<16> rising, falling;
+    uint32_t t = 0xFFFFF000u;
+    for(int16_t k = 0; k < 40; ++k, t += 1920)
+    {
+        rising.push(static_cast<int16_t>(k * 4), t);
+        falling.push(static_cast<int16_t>(-k * 4), t);
+        if(k < 1) continue;
+        TEST_ASSERT_EQUAL_INT16(125, rising.rate_x10_per_min());
+        TEST_ASSERT_EQUAL_INT16(-125, falling.rate_x10_per_min());
+    }
+    TEST_ASSERT_EQUAL_UINT8(16, rising.size());
+}
+
+void test_matches_least_squares_reference()
+{
+    std::mt19937 rng(3);
+    long queries = 0;
+
+    for(int trial = 0; trial < 200; ++trial)
+    {
+        RateEstimator<16> rate;
+        uint8_t window = 16;
+        if(trial % 3) { window = static_cast<uint8_t>(2 + rng() % 15); rate.setWindow(window); }
+
+        std::vector<Point> all;
+        uint32_t t = 0xFFFF0000u + rng() % 100000;                      // Crosses the millis() wrap
+        for(int k = 0; k < 400; ++k)
+        {
+            uint32_t dt = (rng() % 10 == 0) ? 250 : 2000;               // Defrost / normal periods
+            if(rng() % 97 == 0) dt = 200000 + rng() % 400000;           // Fault gap: empties the window
+            t += dt;
+
+            const int16_t x = static_cast<int16_t>(static_cast<int>(200 * std::sin(k / 20.0)) + static_cast<int>(rng() % 11) - 5);
+            rate.push(x, t);
+            all.push_back({static_cast<double>(t >> Sampling::RATE_TIME_SHIFT), static_cast<double>(x)});
+
+            size_t kept = 0;
+            const double expected = referenceRate(all, window, kept);
+            ++queries;
+
+            TEST_ASSERT_EQUAL_UINT8(kept, rate.size());
+            if(std::isnan(expected))
+            {
+                TEST_ASSERT_FALSE(rate.isReady());
+                continue;
+            }
+            TEST_ASSERT_TRUE(std::fabs(expected - rate.rate_x10_per_min()) <= 0.5001);
+        }
+    }
+    TEST_ASSERT_EQUAL_INT32(80000, queries);
+}
+
+int main(int, char**)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_not_ready_below_two_readings);
+    RUN_TEST(test_linear_ramp_across_millis_wrap);
+    RUN_TEST(test_matches_least_squares_reference);
+    return UNITY_END();
+}
@@ -0,0 +1,109 @@
+/**
+ * @file test_main.cpp
+ * @brief ReadingHistory against a std::deque reference (pio test -e native -f test_reading_history)
+ *
+ * @details
+ *  - The reference keeps the last window() values in a deque and rescans it on every push:
+ *    min / max / mean (rounded half away from zero) / latest / size must match after each of 20,000 pushes.
+ *  - Drifting random values exercise both monotonic deques (long runs and frequent front evictions);
+ *    capacities cover the 8-bit (<= 256) and 16-bit index types, windows the default and setWindow().
+ */
+
+#include <unity.h>
+
+#include <algorithm>
+#include <cmath>
+#include <deque>
+#include <random>
+
+#include "Model/ReadingHistory.h"
+
+namespace
+{
+    template<uint16_t Capacity>
+    void checkAgainstDeque(uint16_t window, unsigned seed)
+    {
+        ReadingHistory<Capacity> history;
+        if(window) history.setWindow(window);
+        const uint16_t size = history.window();
+
+        std::mt19937 rng(seed);
+        std::deque<int> reference;
+
+        for(int i = 0; i < 20000; ++i)
+        {
+            const int value = static_cast<int>(rng() % 200) - 100 + (i / 500) * 3;     // Noise on a slow drift
+            history.push(static_cast<int16_t>(value));
+            reference.push_back(value);
+            if(reference.size() > size) reference.pop_front();
+
+            long sum = 0;
+            for(int x : reference) sum += x;
+            const int mean = static_cast<int>(std::lround(static_cast<double>(sum) / static_cast<double>(reference.size())));
+
+            TEST_ASSERT_EQUAL_UINT16(reference.size(), history.size());
+            TEST_ASSERT_EQUAL_INT16(*std::min_element(reference.begin(), reference.end()), history.min_x10());
+            TEST_ASSERT_EQUAL_INT16(*std::max_element(reference.begin(), reference.end()), history.max_x10());
+            TEST_ASSERT_EQUAL_INT16(mean, history.mean_x10());
+            TEST_ASSERT_EQUAL_INT16(value, history.latest_x10());
+        }
+    }
+}
+
+void setUp() {}
+void tearDown() {}
+
+void test_empty_history_is_invalid()
+{
+    ReadingHistory<8> history;
+    TEST_ASSERT_EQUAL_UINT16(0, history.size());
+    TEST_ASSERT_EQUAL_INT16(Sensors::INVALID_READING_X10, history.mean_x10());
+    TEST_ASSERT_EQUAL_INT16(Sensors::INVALID_READING_X10, history.min_x10());
+    TEST_ASSERT_EQUAL_INT16(Sensors::INVALID_READING_X10, history.max_x10());
+    TEST_ASSERT_EQUAL_INT16(Sensors::INVALID_READING_X10, history.latest_x10());
+}
+
+void test_readings_without_value_are_skipped()
+{
+    ReadingHistory<8> history;
+    Reading reading;
+    reading.temperature_x10 = 42;
+    reading.status = ReadingStatus::ShortCircuit;
+    TEST_ASSERT_FALSE(history.push(reading));
+    TEST_ASSERT_EQUAL_UINT16(0, history.size());
+
+    reading.status = ReadingStatus::Ok;
+    TEST_ASSERT_TRUE(history.push(reading));
+    TEST_ASSERT_EQUAL_INT16(42, history.latest_x10());
+}
+
+void test_mean_rounds_ties_away_from_zero()
+{
+    ReadingHistory<2> history;
+    history.push(1);
+    history.push(2);
+    TEST_ASSERT_EQUAL_INT16(2, history.mean_x10());     // 1.5 -> 2
+    history.push(-2);
+    history.push(-1);
+    TEST_ASSERT_EQUAL_INT16(-2, history.mean_x10());    // -1.5 -> -2
+}
+
+void test_default_window_8_bit_index()    { checkAgainstDeque<30>(0, 1); }
+void test_short_window_8_bit_index()      { checkAgainstDeque<30>(7, 2); }
+void test_full_256_slots_8_bit_index()    { checkAgainstDeque<256>(0, 4); }
+void test_default_window_16_bit_index()   { checkAgainstDeque<300>(0, 3); }
+void test_single_sample_window()          { checkAgainstDeque<2>(1, 5); }
+
+int main(int, char**)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_empty_history_is_invalid);
+    RUN_TEST(test_readings_without_value_are_skipped);
+    RUN_TEST(test_mean_rounds_ties_away_from_zero);
+    RUN_TEST(test_default_window_8_bit_index);
+    RUN_TEST(test_short_window_8_bit_index);
+    RUN_TEST(test_full_256_slots_8_bit_index);
+    RUN_TEST(test_default_window_16_bit_index);
+    RUN_TEST(test_single_sample_window);
+    return UNITY_END();
+}
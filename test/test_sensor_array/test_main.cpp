@@ -0,0 +1,186 @@
+/**
+ * @file test_main.cpp
+ * @brief SensorArray scheduler on split-phase fake samplers (pio test -e native -f test_sensor_array)
+ *
+ * @details
+ *  - TemperatureSensor.cpp is built on the host stubs (test/stubs) with logs off; the test owns millis()
+ *    and decides when each fake sampler finishes its conversion.
+ *  - Checks the deadline order, the NotConfigured report of a failed request and that an acquisition
+ *    cancelled through sensor(i) (cancelReading(), addSampler() with another sampler) never stalls the array.
+ */
+
+#define ARDUINO 10819
+#define LOG_ENABLE 0
+
+#include <unity.h>
+
+#include "../../src/Model/TemperatureSensor.cpp"
+#include "Model/SensorArray.h"
+
+namespace
+{
+    unsigned long now = 0;              // millis()
+
+    /// @brief Split-phase sampler whose conversion ends when the test says so
+    class FakeSampler : public ISampler
+    {
+        public:
+
+            uint16_t sample() override { return value; }
+            void startSample() override { busy = true; ++starts; }
+            void cancelSample() override { busy = false; ++cancels; }
+
+            bool pollSample(uint16_t& adc_raw) override
+            {
+                if(!busy || !done) return false;
+                busy = false;
+                done = false;
+                adc_raw = value;
+                return true;
+            }
+
+            uint16_t value = 512;
+            bool busy = false;
+            bool done = false;
+            int starts = 0;
+            int cancels = 0;
+    };
+
+    class FakeDivider : public IResistanceConverter
+    {
+        public:
+            uint32_t convertToResistance_x10(uint16_t adc_raw) override { return static_cast<uint32_t>(adc_raw) * 100u; }
+    };
+
+    class FakeLut : public ITemperatureConverter
+    {
+        public:
+            int16_t convertToTemperature_x10(uint32_t resistance_x10) const noexcept override
+            {
+                return static_cast<int16_t>(resistance_x10 / 1000u);
+            }
+    };
+
+    FakeDivider divider;
+    FakeLut lut;
+
+    void configure(TemperatureSensor& sensor, ISampler* sampler)
+    {
+        sensor.addSampler(sampler).addResistanceConverter(&divider).addTemperatureConverter(&lut).build();
+    }
+}
+
+unsigned long millis() { return now; }
+
+void setUp() { now = 1000; }
+void tearDown() {}
+
+void test_channels_take_turns_on_the_adc()
+{
+    SensorArray<2> sensors;
+    FakeSampler s0, s1;
+    configure(sensors.sensor(0), &s0);
+    configure(sensors.sensor(1), &s1);
+    sensors.setPeriod(0, 100).setPeriod(1, 100).begin();
+
+    uint8_t channel = 0xFF;
+    TEST_ASSERT_FALSE(sensors.update(channel));             // Channel 0 started
+    TEST_ASSERT_EQUAL_INT(1, s0.starts);
+    TEST_ASSERT_FALSE(sensors.update(channel));             // ADC busy: channel 1 waits
+    TEST_ASSERT_EQUAL_INT(0, s1.starts);
+
+    s0.done = true;
+    TEST_ASSERT_TRUE(sensors.update(channel));              // Channel 0 completes, channel 1 starts
+    TEST_ASSERT_EQUAL_UINT8(0, channel);
+    TEST_ASSERT_EQUAL_INT16(51, sensors.reading(0).temperature_x10);
+    TEST_ASSERT_EQUAL_INT(1, s1.starts);
+
+    s1.done = true;
+    TEST_ASSERT_TRUE(sensors.update(channel));
+    TEST_ASSERT_EQUAL_UINT8(1, channel);
+    TEST_ASSERT_EQUAL_INT(1, s0.starts);                    // Not due again before its period
+}
+
+void test_failed_request_is_reported_as_not_configured()
+{
+    SensorArray<2> sensors;
+    FakeSampler s1;
+    configure(sensors.sensor(1), &s1);                      // Channel 0 has no pipeline
+    sensors.setPeriod(0, 100).setPeriod(1, 100).begin();
+
+    uint8_t channel = 0xFF;
+    TEST_ASSERT_TRUE(sensors.update(channel));
+    TEST_ASSERT_EQUAL_UINT8(0, channel);
+    TEST_ASSERT_EQUAL_INT(static_cast<int>(ReadingStatus::NotConfigured), static_cast<int>(sensors.reading(0).status));
+
+    TEST_ASSERT_FALSE(sensors.update(channel));             // Channel 1 started on the free ADC
+    TEST_ASSERT_EQUAL_INT(1, s1.starts);
+}
+
+void test_cancelled_acquisition_does_not_stall_the_array()
+{
+    SensorArray<2> sensors;
+    FakeSampler s0, s1;
+    configure(sensors.sensor(0), &s0);
+    configure(sensors.sensor(1), &s1);
+    sensors.setPeriod(0, 100).setPeriod(1, 100).begin();
+
+    uint8_t channel = 0xFF;
+    TEST_ASSERT_FALSE(sensors.update(channel));             // Channel 0 in flight
+    sensors.sensor(0).cancelReading();
+    TEST_ASSERT_EQUAL_INT(1, s0.cancels);
+
+    TEST_ASSERT_FALSE(sensors.update(channel));             // Nothing to report, channel 1 starts
+    TEST_ASSERT_EQUAL_INT(1, s1.starts);
+
+    s1.done = true;
+    TEST_ASSERT_TRUE(sensors.update(channel));
+    TEST_ASSERT_EQUAL_UINT8(1, channel);
+
+    now += 100;                                             // Channel 0 due again: sampled as usual
+    TEST_ASSERT_FALSE(sensors.update(channel));
+    TEST_ASSERT_EQUAL_INT(2, s0.starts);
+    s0.done = true;
+    TEST_ASSERT_TRUE(sensors.update(channel));
+    TEST_ASSERT_EQUAL_UINT8(0, channel);
+}
+
+void test_sampler_replaced_while_in_flight()
+{
+    SensorArray<2> sensors;
+    FakeSampler s0, s1, replacement;
+    replacement.value = 300;
+    configure(sensors.sensor(0), &s0);
+    configure(sensors.sensor(1), &s1);
+    sensors.setPeriod(0, 100).setPeriod(1, 100).begin();
+
+    uint8_t channel = 0xFF;
+    TEST_ASSERT_FALSE(sensors.update(channel));             // Channel 0 in flight on s0
+    sensors.sensor(0).addSampler(&replacement);             // Reconfigured: the old request is cancelled
+    TEST_ASSERT_EQUAL_INT(1, s0.cancels);
+    TEST_ASSERT_FALSE(s0.busy);
+
+    // The array keeps running: channel 1 completes, channel 0 resumes on the new sampler
+    for(int loop = 0; loop < 50; ++loop)
+    {
+        s1.done = s1.busy;
+        replacement.done = replacement.busy;
+        if(sensors.update(channel) && channel == 0) break;
+        now += 10;
+    }
+    TEST_ASSERT_EQUAL_UINT8(0, channel);
+    TEST_ASSERT_EQUAL_INT(1, s0.starts);
+    TEST_ASSERT_EQUAL_INT(1, replacement.starts);
+    TEST_ASSERT_EQUAL_INT16(30, sensors.reading(0).temperature_x10);
+    TEST_ASSERT_TRUE(s1.starts >= 1);
+}
+
+int main(int, char**)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_channels_take_turns_on_the_adc);
+    RUN_TEST(test_failed_request_is_reported_as_not_configured);
+    RUN_TEST(test_cancelled_acquisition_does_not_stall_the_array);
+    RUN_TEST(test_sampler_replaced_while_in_flight);
+    return UNITY_END();
+}
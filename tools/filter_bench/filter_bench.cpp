@@ -0,0 +1,259 @@
+/**
+ * @file filter_bench.cpp
+ * @brief Host-run benchmark and characterisation suite for every IFilter<int16_t> implementation
+ *
+ * @details
+ *  Drives each filter (through IFilter<int16_t>*, exactly like TemperatureSensor does) with synthetic
+ *  traces in the temperature_x10 domain and reports:
+ *  - rise    : readings from 10% to 90% of a 100 LSB (10.0 °C) step
+ *  - settle  : readings until the output stays within +/-2 LSB of the step target
+ *  - ovs     : step overshoot in LSB
+ *  - lag     : steady lag behind a 0.5 LSB/reading ramp (door-open / defrost shape)
+ *  - bias    : worst |output - input| after settling on noise-free constants (truncation bias shows here)
+ *  - nbias   : mean (output - input) on a noisy constant
+ *  - atten   : output noise sd / input noise sd (sigma = 2 LSB gaussian), lower is smoother
+ *  - spike   : readings off by more than 1 LSB after a single +50.0 °C glitch
+ *  - ns      : host nanoseconds per apply() (relative cost only; AVR cycles must be measured on target)
+ *
+ *  Build & run from the repository root (host compiler, no Arduino core needed):
+ *      g++ -std=gnu++17 -O2 -Iinclude tools/filter_bench/filter_bench.cpp src/Filter/KalmanFilter.cpp -o filter_bench
+ *      ./filter_bench                  # table
+ *      ./filter_bench --max-bias 0.5   # exit 1 if a filter flagged unbiased exceeds 0.5 LSB (regression gate)
+ */
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "interfaces/IFilter.h"
+#include "Filter/EmaFilter.h"
+#include "Filter/SmaFilter.h"
+#include "Filter/FixedEmaFilter.h"
+#include "Filter/AdaptiveEmaFilter.h"
+#include "Filter/KalmanFilter.h"
+#include "Filter/HampelFilter.h"
+#include "Filter/MedianOf3.h"
+#include "Filter/FilterChain.h"
+
+namespace
+{
+    using FilterPtr = std::unique_ptr<IFilter<int16_t>>;
+
+    /// @brief One filter under test: a factory so every trace starts from a fresh instance
+    struct Candidate
+    {
+        const char* name;
+        std::function<FilterPtr()> make;
+        bool unbiased;      // Expected to settle on the input (checked by --max-bias)
+    };
+
+    /// @brief Build a filter and run its begin()
+    template<typename F, typename... Args>
+    FilterPtr make(Args... args)
+    {
+        auto f = std::unique_ptr<F>(new F(args...));
+        f->begin();
+        return FilterPtr(f.release());
+    }
+
+    struct Result
+    {
+        int rise = -1;
+        int settle = -1;
+        double overshoot = 0;
+        double lag = 0;
+        double bias = 0;
+        double noisyBias = 0;
+        double attenuation = 0;
+        int spike = 0;
+        double ns = 0;
+    };
+
+    constexpr int16_t BASE = 40;            // 4.0 °C fridge set point
+    constexpr int16_t STEP = 100;           // 10.0 °C step
+    constexpr double  NOISE_SIGMA = 2.0;    // 0.2 °C reading noise
+    constexpr int     WARM = 200;           // Readings to settle before measuring
+
+    /// @brief Step response: rise 10-90%, settling to +/-2 LSB, overshoot
+    void step(IFilter<int16_t>& f, Result& r)
+    {
+        for(int i = 0; i < WARM; ++i) f.apply(BASE);
+
+        const int16_t target = BASE + STEP;
+        int t10 = -1, t90 = -1, lastOut = -1;
+        int16_t peak = BASE;
+        for(int i = 0; i < 400; ++i)
+        {
+            const int16_t y = f.apply(target);
+            if(t10 < 0 && y >= BASE + STEP / 10) t10 = i;
+            if(t90 < 0 && y >= BASE + STEP * 9 / 10) t90 = i;
+            if(std::abs(y - target) > 2) lastOut = i;
+            if(y > peak) peak = y;
+        }
+        r.rise = (t10 >= 0 && t90 >= 0) ? (t90 - t10 + 1) : -1;
+        r.settle = lastOut + 1;
+        r.overshoot = (peak > target) ? (peak - target) : 0;
+    }
+
+    /// @brief Steady lag behind a ramp
+    void ramp(IFilter<int16_t>& f, Result& r)
+    {
+        for(int i = 0; i < WARM; ++i) f.apply(BASE);
+
+        double lag = 0;
+        int n = 0;
+        for(int i = 0; i < 600; ++i)
+        {
+            const double x = BASE + 0.5 * i;
+            const int16_t y = f.apply(static_cast<int16_t>(std::lround(x)));
+            if(i >= 400) { lag += x - y; ++n; }
+        }
+        r.lag = lag / n;
+    }
+
+    /// @brief Noise-free constants: worst steady-state error
+    void bias(const Candidate& c, Result& r)
+    {
+        double worst = 0;
+        for(int16_t target : {-183, -37, -3, 1, 37, 251})
+        {
+            FilterPtr f = c.make();
+            f->apply(0);                                    // Start away from the target (e.g. after a defrost)
+            int16_t y = 0;
+            for(int i = 0; i < 1000; ++i) y = f->apply(target);
+            worst = std::max(worst, std::fabs(static_cast<double>(y - target)));
+        }
+        r.bias = worst;
+    }
+
+    /// @brief Noisy constant: mean error and noise attenuation
+    void noise(IFilter<int16_t>& f, Result& r)
+    {
+        std::mt19937 gen(1234);
+        std::normal_distribution<double> nd(0.0, NOISE_SIGMA);
+
+        for(int i = 0; i < WARM; ++i) f.apply(static_cast<int16_t>(std::lround(BASE + nd(gen))));
+
+        double sum = 0, sum2 = 0, sumIn = 0, sumIn2 = 0;
+        const int N = 50000;
+        for(int i = 0; i < N; ++i)
+        {
+            const int16_t x = static_cast<int16_t>(std::lround(BASE + nd(gen)));
+            const int16_t y = f.apply(x);
+            sum += y;   sum2 += static_cast<double>(y) * y;
+            sumIn += x; sumIn2 += static_cast<double>(x) * x;
+        }
+        const double mean = sum / N;
+        const double sdOut = std::sqrt(std::max(0.0, sum2 / N - mean * mean));
+        const double meanIn = sumIn / N;
+        const double sdIn = std::sqrt(sumIn2 / N - meanIn * meanIn);
+        r.noisyBias = mean - meanIn;
+        r.attenuation = sdOut / sdIn;
+    }
+
+    /// @brief Single glitch: how many readings it contaminates
+    void spike(IFilter<int16_t>& f, Result& r)
+    {
+        for(int i = 0; i < WARM; ++i) f.apply(BASE);
+
+        f.apply(BASE + 500);
+        int bad = (std::abs(f.apply(BASE) - BASE) > 1) ? 1 : 0;
+        for(int i = 0; i < 200; ++i)
+            if(std::abs(f.apply(BASE) - BASE) > 1) ++bad;
+
+        // The glitch reading itself counts too when it passes through
+        r.spike = bad;
+    }
+
+    /// @brief Host cost per apply() through the interface (relative only)
+    void timing(IFilter<int16_t>& f, Result& r)
+    {
+        std::mt19937 gen(99);
+        std::vector<int16_t> trace(4096);
+        for(auto& v : trace) v = static_cast<int16_t>(BASE + static_cast<int>(gen() % 9) - 4);
+
+        volatile int16_t sink = 0;
+        const int ROUNDS = 500;
+        const auto t0 = std::chrono::steady_clock::now();
+        for(int k = 0; k < ROUNDS; ++k)
+            for(int16_t v : trace) sink = f.apply(v);
+        const auto t1 = std::chrono::steady_clock::now();
+        (void)sink;
+
+        r.ns = std::chrono::duration<double, std::nano>(t1 - t0).count() / (ROUNDS * trace.size());
+    }
+
+    Result characterise(const Candidate& c)
+    {
+        Result r;
+        { FilterPtr f = c.make(); step(*f, r); }
+        { FilterPtr f = c.make(); ramp(*f, r); }
+        bias(c, r);
+        { FilterPtr f = c.make(); noise(*f, r); }
+        { FilterPtr f = c.make(); spike(*f, r); }
+        { FilterPtr f = c.make(); timing(*f, r); }
+        return r;
+    }
+
+    std::vector<Candidate> candidates()
+    {
+        return {
+            { "EmaFilter(0.15)",              [] { return make<EmaFilter<int16_t>>(Filtering::EMA_ALPHA_DEFAULT); },              false },
+            { "SmaFilter<8>",                 [] { return make<SmaFilter<int16_t, 8>>(); },                                         true  },
+            { "SmaFilter<8,approx>",          [] { return make<SmaFilter<int16_t, 8, true>>(); },                                   true  },
+            { "ShiftEma<3>",                  [] { return make<ShiftEmaFilter<int16_t>>(); },                                       true  },
+            { "Q8Ema(38)",                    [] { return make<Q8EmaFilter<int16_t>>(); },                                          true  },
+            { "AdaptiveEma(16..192)",         [] { return make<AdaptiveEmaFilter<int16_t>>(); },                                    true  },
+            { "Kalman(level)",                [] { return make<KalmanFilter>(); },                                                  true  },
+            { "Kalman(level+rate)",           [] { return make<KalmanFilter>(Filtering::KALMAN_MEASUREMENT_NOISE, 0.01f, Filtering::KALMAN_RATE_NOISE, true); }, true },
+            { "Hampel<5>",                    [] { return make<HampelFilter<>>(); },                                                true  },
+            { "Median3>ShiftEma<3>",          [] { return make<FilterChain<int16_t, MedianOf3<int16_t>, ShiftEmaFilter<int16_t>>>(); },   true },
+            { "Hampel<5>>ShiftEma<2>",        [] { return make<FilterChain<int16_t, HampelFilter<>, ShiftEmaFilter<int16_t, 2>>>(); },    true },
+        };
+    }
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    double maxBias = -1.0;
+    for(int i = 1; i < argc; ++i)
+    {
+        if(std::strcmp(argv[i], "--max-bias") == 0 && i + 1 < argc) maxBias = std::atof(argv[++i]);
+        else
+        {
+            std::fprintf(stderr, "usage: %s [--max-bias <lsb>]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    std::printf("Units: LSB = 0.1 degC, times in readings. Step %d LSB, ramp 0.5 LSB/reading, noise sigma %.1f LSB\n\n",
+                STEP, NOISE_SIGMA);
+    std::printf("%-24s %5s %6s %5s %6s %5s %6s %6s %5s %7s\n",
+                "filter", "rise", "settle", "ovs", "lag", "bias", "nbias", "atten", "spike", "ns");
+
+    int failures = 0;
+    for(const Candidate& c : candidates())
+    {
+        const Result r = characterise(c);
+        const bool fail = (maxBias >= 0) && c.unbiased && (r.bias > maxBias);
+        failures += fail ? 1 : 0;
+
+        std::printf("%-24s %5d %6d %5.0f %6.2f %5.0f %6.2f %6.3f %5d %7.1f%s\n",
+                    c.name, r.rise, r.settle, r.overshoot, r.lag, r.bias, r.noisyBias, r.attenuation, r.spike, r.ns,
+                    fail ? "  <-- bias regression" : "");
+    }
+
+    if(failures)
+    {
+        std::printf("\n%d filter(s) exceed --max-bias %.2f LSB\n", failures, maxBias);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,252 @@
+/**
+ * @file LogDecoder.h
+ * @brief Binary log frame parser and formatter (host only, shared by log_decoder and test/test_binary_log)
+ *
+ * @details
+ *  - FrameDecoder takes the capture in pieces of any size (serial reads, file chunks): complete frames are
+ *    decoded as soon as their last byte arrives, a partial frame waits in a small buffer for the next piece;
+ *    finish() resolves what is still waiting at the end of the capture.
+ *  - Frames with a bad length / checksum are skipped one byte at a time (resynchronises on the next sync byte).
+ *  - Arguments are typed on the wire, so mismatched specifiers (%d given a long) still print the value.
+ */
+#pragma once
+
+#include <cctype>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "logger/BinaryLog.h"
+
+
+namespace log_decoder
+{
+    using namespace logger::binary;
+
+    /// @brief One decoded argument
+    struct Arg
+    {
+        uint8_t tag = 0;
+        int64_t integer = 0;
+        double real = 0.0;
+        std::string text;
+    };
+
+    inline uint32_t readLe(const uint8_t* p, uint8_t n)
+    {
+        uint32_t v = 0;
+        for(uint8_t i = 0; i < n; ++i) v |= static_cast<uint32_t>(p[i]) << (8 * i);
+        return v;
+    }
+
+    /// @brief Split the argument bytes of a payload into typed values (stops at the first malformed one)
+    inline std::vector<Arg> parseArgs(const uint8_t* p, size_t size)
+    {
+        std::vector<Arg> args;
+        size_t i = 0;
+        while(i < size)
+        {
+            Arg a;
+            a.tag = p[i++];
+            const size_t n = (a.tag == TAG_I16 || a.tag == TAG_U16 || a.tag == TAG_PTR) ? 2 :
+                             (a.tag == TAG_I32 || a.tag == TAG_U32 || a.tag == TAG_F32) ? 4 : 0;
+
+            if(a.tag == TAG_STR)
+            {
+                while(i < size && p[i] != 0) a.text += static_cast<char>(p[i++]);
+                ++i;                                                    // NUL
+            }
+            else if(n == 0 || i + n > size)
+            {
+                break;
+            }
+            else
+            {
+                const uint32_t bits = readLe(&p[i], static_cast<uint8_t>(n));
+                i += n;
+                switch(a.tag)
+                {
+                    case TAG_I16: a.integer = static_cast<int16_t>(bits); break;
+                    case TAG_I32: a.integer = static_cast<int32_t>(bits); break;
+                    case TAG_F32: { float f; memcpy(&f, &bits, 4); a.real = f; a.integer = static_cast<int64_t>(f); break; }
+                    default:      a.integer = bits; break;              // U16 / U32 / PTR
+                }
+            }
+            if(a.tag != TAG_F32) a.real = static_cast<double>(a.integer);
+            args.push_back(a);
+        }
+        return args;
+    }
+
+    /// @brief printf the AVR format string with the typed arguments (host types, same output)
+    inline std::string format(const char* fmt, const std::vector<Arg>& args)
+    {
+        std::string out;
+        size_t next = 0;
+        char buf[256];
+
+        for(const char* c = fmt; *c; ++c)
+        {
+            if(*c != '%') { out += *c; continue; }
+            if(c[1] == '%') { out += '%'; ++c; continue; }
+
+            // Spec: flags, width, precision (kept) + length (dropped: the tag gives the size) + conversion
+            std::string spec = "%";
+            ++c;
+            while(*c && strchr("-+ #0", *c)) spec += *c++;
+            while(*c && (isdigit(static_cast<unsigned char>(*c)) || *c == '.')) spec += *c++;
+            while(*c && strchr("hlzjt", *c)) ++c;
+            if(!*c) break;
+            const char conv = *c;
+
+            if(next >= args.size()) { out += "<?>"; continue; }
+            const Arg& a = args[next++];
+
+            switch(conv)
+            {
+                case 'd': case 'i':
+                    snprintf(buf, sizeof(buf), (spec + "lld").c_str(), static_cast<long long>(a.integer));
+                    break;
+                case 'u': case 'x': case 'X': case 'o':
+                {
+                    // Negative 16/32-bit values print like the AVR would (two's complement of their size)
+                    const uint64_t mask = (a.tag == TAG_I16) ? 0xFFFFu : 0xFFFFFFFFu;
+                    snprintf(buf, sizeof(buf), (spec + "ll" + conv).c_str(), static_cast<unsigned long long>(a.integer) & mask);
+                    break;
+                }
+                case 'c':
+                    snprintf(buf, sizeof(buf), (spec + "c").c_str(), static_cast<int>(a.integer));
+                    break;
+                case 'p':
+                    snprintf(buf, sizeof(buf), "0x%04llx", static_cast<unsigned long long>(a.integer));
+                    break;
+                case 's': case 'S':
+                    snprintf(buf, sizeof(buf), (spec + "s").c_str(), (a.tag == TAG_STR) ? a.text.c_str() : "<?>");
+                    break;
+                case 'f': case 'F': case 'e': case 'E': case 'g': case 'G':
+                    snprintf(buf, sizeof(buf), (spec + conv).c_str(), a.real);
+                    break;
+                default:
+                    snprintf(buf, sizeof(buf), "<%%%c?>", conv);
+                    break;
+            }
+            out += buf;
+        }
+        return out;
+    }
+
+    /**
+     * @brief Incremental frame decoder: "[<millis> ms] [<level>] <formatted message>" per complete frame
+     */
+    class FrameDecoder
+    {
+        public:
+
+            /// @param image - Firmware image (format strings at their flash addresses)
+            explicit FrameDecoder(std::vector<uint8_t> image): image_(std::move(image)), decoded_(0), skipped_(0) {}
+
+            /**
+             * @brief Append captured bytes and decode every frame they complete
+             *
+             * @param bytes - Next piece of the capture (any size, frames may straddle pieces)
+             * @param size - Bytes in the piece
+             * @param emit - Called with each decoded line (no trailing newline), in capture order
+             */
+            template<typename Emit>
+            void feed(const uint8_t* bytes, size_t size, Emit&& emit)
+            {
+                pending_.insert(pending_.end(), bytes, bytes + size);
+                parse(emit, false);
+            }
+
+            /**
+             * @brief End of the capture: a frame still waiting for bytes is noise (e.g. a false sync byte
+             *        with a large length), skip it byte by byte and decode what follows
+             */
+            template<typename Emit>
+            void finish(Emit&& emit)
+            {
+                parse(emit, true);
+            }
+
+            /// @brief Frames decoded so far
+            size_t decoded() const { return decoded_; }
+
+            /// @brief Bytes skipped so far (noise, corrupted frames)
+            size_t skipped() const { return skipped_; }
+
+            /// @brief Bytes waiting for the rest of their frame (0 after finish())
+            size_t pending() const { return pending_.size(); }
+
+        private:
+
+            template<typename Emit>
+            void parse(Emit& emit, bool at_end)
+            {
+                size_t i = 0;
+                while(i < pending_.size())
+                {
+                    // Step1: Frame = sync, len, payload, checksum (wait for the missing bytes of a frame)
+                    if(pending_[i] != FRAME_SYNC) { ++i; ++skipped_; continue; }
+                    const bool hasLength = i + 2 <= pending_.size();
+                    const uint8_t len = hasLength ? pending_[i + 1] : 0;
+                    if(hasLength && (len < HEADER_SIZE || len > 255 - FRAME_OVERHEAD)) { ++i; ++skipped_; continue; }
+                    if(!hasLength || i + 2 + len + 1 > pending_.size())
+                    {
+                        if(!at_end) break;
+                        ++i; ++skipped_;
+                        continue;
+                    }
+
+                    const uint8_t* payload = &pending_[i + 2];
+                    uint8_t checksum = 0;
+                    for(uint8_t k = 0; k < len; ++k) checksum ^= payload[k];
+                    if(checksum != payload[len]) { ++i; ++skipped_; continue; }
+
+                    // Step2: Header + message
+                    emit(decode(payload, len));
+                    ++decoded_;
+                    i += 2 + len + 1;
+                }
+                pending_.erase(pending_.begin(), pending_.begin() + static_cast<std::ptrdiff_t>(i));
+            }
+
+            std::string decode(const uint8_t* payload, uint8_t len) const
+            {
+                const uint16_t id = static_cast<uint16_t>(readLe(payload, 2));
+                const uint32_t ms = readLe(payload + 2, 4);
+                const char level = static_cast<char>(payload[6]);
+                const std::vector<Arg> args = parseArgs(payload + HEADER_SIZE, len - HEADER_SIZE);
+
+                // Message: format string from the firmware image
+                std::string text;
+                if(id == DROP_RECORD_ID)
+                {
+                    text = "logger: " + std::to_string(args.empty() ? 0 : args[0].integer) + " record(s) dropped (ring full)";
+                }
+                else if(id < image_.size() && memchr(&image_[id], 0, image_.size() - id))
+                {
+                    text = format(reinterpret_cast<const char*>(&image_[id]), args);
+                }
+                else
+                {
+                    char unknown[64];
+                    snprintf(unknown, sizeof(unknown), "<unknown message id 0x%04x: firmware image mismatch?>", id);
+                    text = unknown;
+                }
+
+                char prefix[32];
+                snprintf(prefix, sizeof(prefix), "[%lu ms] [%c] ", static_cast<unsigned long>(ms), level);
+                return prefix + text;
+            }
+
+            std::vector<uint8_t> image_;
+            std::vector<uint8_t> pending_;      // Unconsumed capture bytes (at most one partial frame + noise)
+            size_t decoded_;
+            size_t skipped_;
+    };
+
+} // namespace log_decoder
@@ -0,0 +1,80 @@
+/**
+ * @file log_decoder.cpp
+ * @brief Host-side decoder for the binary log (LOG_BINARY=1, see include/logger/BinaryLog.h)
+ *
+ * @details
+ *  Every binary record carries the flash address of its PSTR() format string as message ID, so the format
+ *  table is the firmware image itself: the decoder reads the NUL-terminated string at that offset and
+ *  prints the record exactly like the text logger would:
+ *      [<millis> ms] [<level>] <formatted message>
+ *  - The capture is decoded while it arrives: each record is printed (and stdout flushed) as soon as its
+ *    last byte is read, so a serial port piped into the decoder shows the log live.
+ *  - Frames with a bad length / checksum are skipped (resynchronises on the next sync byte).
+ *  - Arguments are typed on the wire, so mismatched specifiers (%d given a long) still print the value.
+ *  - Parsing and formatting live in LogDecoder.h (shared with the native unit test test/test_binary_log).
+ *
+ *  Build & run from the repository root (host compiler, no Arduino core needed):
+ *      g++ -std=gnu++17 -O2 -Iinclude -Itools tools/log_decoder/log_decoder.cpp -o log_decoder
+ *      avr-objcopy -O binary -R .eeprom .pio/build/nanoatmega328/firmware.elf firmware.bin
+ *      ./log_decoder firmware.bin capture.bin          # capture.bin: raw bytes saved from the serial port
+ *      stty -F /dev/ttyUSB0 115200 raw && ./log_decoder firmware.bin - < /dev/ttyUSB0     # live
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "log_decoder/LogDecoder.h"
+
+
+namespace
+{
+    bool readFile(const char* path, std::vector<uint8_t>& data)
+    {
+        FILE* f = fopen(path, "rb");
+        if(!f) return false;
+        uint8_t chunk[4096];
+        size_t n;
+        while((n = fread(chunk, 1, sizeof(chunk), f)) > 0) data.insert(data.end(), chunk, chunk + n);
+        fclose(f);
+        return true;
+    }
+}
+
+
+int main(int argc, char** argv)
+{
+    if(argc != 3)
+    {
+        fprintf(stderr, "usage: %s <firmware.bin> <capture.bin | ->\n", argv[0]);
+        return 2;
+    }
+
+    std::vector<uint8_t> image;
+    if(!readFile(argv[1], image)) { fprintf(stderr, "cannot read %s\n", argv[1]); return 2; }
+
+    FILE* capture = (strcmp(argv[2], "-") == 0) ? stdin : fopen(argv[2], "rb");
+    if(!capture) { fprintf(stderr, "cannot read %s\n", argv[2]); return 2; }
+
+    // Byte by byte: getc() returns what the port delivered without waiting for a full block (fread() would)
+    log_decoder::FrameDecoder decoder(std::move(image));
+    const auto print = [](const std::string& line)
+    {
+        printf("%s\n", line.c_str());
+        fflush(stdout);
+    };
+    int c;
+    while((c = getc(capture)) != EOF)
+    {
+        const uint8_t byte = static_cast<uint8_t>(c);
+        decoder.feed(&byte, 1, print);
+    }
+    decoder.finish(print);
+    if(capture != stdin) fclose(capture);
+
+    fprintf(stderr, "%zu record(s) decoded, %zu byte(s) skipped\n", decoder.decoded(), decoder.skipped());
+    return 0;
+}